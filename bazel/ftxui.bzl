@@ -49,6 +49,13 @@ def ftxui_cc_library(
         visibility = visibility,
     )
 
+# The screen library serializes large screens using a pool of std::thread.
+def pthread_linkopts():
+    return select({
+        "@platforms//os:windows": [],
+        "//conditions:default": ["-pthread"],
+    })
+
 # Compile all the examples in the examples/ directory.
 # This is useful to check the Bazel is always synchronized against CMake
 # definitions.
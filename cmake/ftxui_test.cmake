@@ -12,6 +12,7 @@ include(cmake/ftxui_find_google_test.cmake)
 
 add_executable(ftxui-tests
   src/ftxui/component/animation_test.cpp
+  src/ftxui/component/bandwidth_monitor_test.cpp
   src/ftxui/component/button_test.cpp
   src/ftxui/component/collapsible_test.cpp
   src/ftxui/component/component_test.cpp
@@ -22,6 +23,7 @@ add_executable(ftxui-tests
   src/ftxui/component/menu_test.cpp
   src/ftxui/component/modal_test.cpp
   src/ftxui/component/radiobox_test.cpp
+  src/ftxui/component/recording_test.cpp
   src/ftxui/component/resizable_split_test.cpp
   src/ftxui/component/app_test.cpp
   src/ftxui/component/slider_test.cpp
@@ -37,12 +39,16 @@ add_executable(ftxui-tests
   src/ftxui/dom/dim_test.cpp
   src/ftxui/dom/flexbox_helper_test.cpp
   src/ftxui/dom/flexbox_test.cpp
+  src/ftxui/dom/frame_arena_test.cpp
   src/ftxui/dom/gauge_test.cpp
   src/ftxui/dom/gridbox_test.cpp
   src/ftxui/dom/hbox_test.cpp
   src/ftxui/dom/hyperlink_test.cpp
   src/ftxui/dom/italic_test.cpp
   src/ftxui/dom/linear_gradient_test.cpp
+  src/ftxui/dom/memo_test.cpp
+  src/ftxui/dom/node_test.cpp
+  src/ftxui/dom/paragraph_test.cpp
   src/ftxui/dom/scroll_indicator_test.cpp
   src/ftxui/dom/selection_test.cpp
   src/ftxui/dom/separator_test.cpp
@@ -51,8 +57,10 @@ add_executable(ftxui-tests
   src/ftxui/dom/text_test.cpp
   src/ftxui/dom/underlined_test.cpp
   src/ftxui/dom/vbox_test.cpp
+  src/ftxui/dom/virtual_list_test.cpp
   src/ftxui/screen/color_test.cpp
   src/ftxui/screen/compatibility_test.cpp
+  src/ftxui/screen/glyph_test.cpp
   src/ftxui/screen/screen_test.cpp
   src/ftxui/screen/string_test.cpp
   src/ftxui/util/ref_test.cpp
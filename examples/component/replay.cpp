@@ -0,0 +1,95 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+
+// Replay a session recorded using App::RecordTo, and measure how fast its
+// frames are serialized into terminal output.
+//
+// Usage: ftxui_example_replay <recording> [iterations]
+
+#include <algorithm>  // for max
+#include <chrono>    // for steady_clock, duration
+#include <cstddef>   // for size_t
+#include <cstdio>    // for printf, fprintf, stderr
+#include <cstdlib>   // for atoi
+#include <string>    // for string
+#include <vector>    // for vector
+
+#include "ftxui/component/recording.hpp"  // for RecordingReader
+#include "ftxui/screen/screen.hpp"        // for Screen
+
+using namespace ftxui;
+
+int main(int argc, const char* argv[]) {
+  if (argc < 2) {
+    std::fprintf(stderr, "Usage: %s <recording> [iterations]\n", argv[0]);
+    return 1;
+  }
+  const int iterations = argc >= 3 ? std::max(1, std::atoi(argv[2])) : 1;
+
+  // Decode the whole recording first. Only the serialization is measured.
+  RecordingReader reader(argv[1]);
+  if (!reader.ok()) {
+    std::fprintf(stderr, "Can't read %s\n", argv[1]);
+    return 1;
+  }
+  std::vector<Screen> frames;
+  size_t events = 0;
+  size_t recording_bytes = 0;
+  while (reader.Next()) {
+    if (reader.type() == RecordingReader::Type::Frame) {
+      frames.push_back(reader.screen());
+      recording_bytes += reader.record_size();
+    } else {
+      events++;
+    }
+  }
+  if (!reader.ok()) {
+    std::fprintf(stderr, "Invalid recording after %zu frames.\n",
+                 frames.size());
+  }
+  if (frames.empty()) {
+    std::fprintf(stderr, "No frames.\n");
+    return 1;
+  }
+
+  // Serialize every frame, the way App does: the first one entirely, the next
+  // ones as a difference with the previous one.
+  std::string output;
+  size_t output_bytes = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    output_bytes = 0;
+    for (size_t i = 0; i < frames.size(); ++i) {
+      output.clear();
+      const bool resized =
+          i == 0 || frames[i].dimx() != frames[i - 1].dimx() ||
+          frames[i].dimy() != frames[i - 1].dimy();
+      if (resized) {
+        frames[i].ToString(output);
+      } else {
+        frames[i].ToString(output, frames[i - 1]);
+      }
+      output_bytes += output.size();
+    }
+  }
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  const double seconds = elapsed.count() / iterations;
+  const auto frame_count = static_cast<double>(frames.size());
+
+  std::printf("Session duration:    %.3f s\n",
+              std::chrono::duration<double>(reader.time()).count());
+  std::printf("Frames:              %zu\n", frames.size());
+  std::printf("Events:              %zu\n", events);
+  std::printf("Recording per frame: %.1f bytes\n",
+              static_cast<double>(recording_bytes) / frame_count);
+  std::printf("Output per frame:    %.1f bytes\n",
+              static_cast<double>(output_bytes) / frame_count);
+  std::printf("Encode time:         %.3f us/frame\n",
+              seconds * 1e6 / frame_count);
+  std::printf("Encode throughput:   %.1f frames/s, %.1f MB/s\n",
+              frame_count / seconds,
+              static_cast<double>(output_bytes) / seconds / 1e6);
+  return 0;
+}
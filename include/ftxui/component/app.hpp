@@ -5,7 +5,8 @@
 #define FTXUI_COMPONENT_APP_HPP
 
 #include <atomic>      // for atomic
-#include <chrono>      // for steady_clock, time_point
+#include <chrono>      // for steady_clock, time_point, microseconds
+#include <cstdint>     // for uint64_t
 #include <functional>  // for function
 #include <memory>      // for shared_ptr, unique_ptr
 #include <string>      // for string, basic_string, allocator
@@ -90,6 +91,51 @@ class FTXUI_EXPORT(COMPONENT) App : public Screen {
   /// @note This feature is only available on POSIX systems (Linux/macOS).
   void HandlePipedInput(bool enable = true);
 
+  /// @brief Record the session into a file: the frames drawn and the events
+  /// received, with their timestamps. It can be read back using
+  /// RecordingReader, to reproduce performance problems offline.
+  /// @param path The file to write. An empty path disables the recording.
+  /// @note This must be called before Loop().
+  void RecordTo(const std::string& path);
+
+  /// @brief Adapt the output to the bandwidth of the terminal, e.g. over a
+  /// slow SSH link. The time spent blocked writing to the terminal is
+  /// measured. When it is significant, frames are coalesced: the next frame is
+  /// drawn only once the previous one is expected to be through, dropping the
+  /// intermediate animation frames.
+  /// @param enable Whether to adapt to the bandwidth.
+  /// @param downgrade_colors Whether to also encode TrueColor colors using the
+  /// 256 colors palette, while the output is under pressure.
+  /// @see GetOutputStats
+  void AdaptToBandwidth(bool enable = true, bool downgrade_colors = false);
+
+  /// @brief Statistics about the output sent to the terminal.
+  struct OutputStats {
+    std::uint64_t frames = 0;          // Frames sent.
+    std::uint64_t frames_dropped = 0;  // Held back frames, replaced unsent.
+    std::uint64_t bytes = 0;           // Bytes written.
+    // Time spent blocked, writing to the terminal.
+    std::chrono::microseconds write_time{0};
+    // Estimated throughput of the terminal, in bytes per second. Zero until
+    // the output blocks.
+    double throughput = 0.0;
+    // Whether the terminal currently doesn't keep up with the output.
+    bool congested = false;
+    // Whether the last frame was encoded using the 256 colors palette.
+    bool colors_downgraded = false;
+  };
+
+  /// @brief Return statistics about the output sent to the terminal.
+  const OutputStats& GetOutputStats() const;
+
+  /// @brief Allocate the elements built while drawing a frame from an arena,
+  /// reset before the next frame. This replaces thousands of small heap
+  /// allocations per frame by pointer bumps. The elements kept from one frame
+  /// to the next stay valid.
+  /// @param enable Whether to use the frame arena.
+  /// @see FrameArena
+  void UseFrameArena(bool enable = true);
+
   /// @brief Return the currently active app, nullptr if none.
   static App* Active();
 
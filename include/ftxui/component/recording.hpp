@@ -0,0 +1,158 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_RECORDING_HPP
+#define FTXUI_COMPONENT_RECORDING_HPP
+
+#include <chrono>         // for microseconds, steady_clock
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t
+#include <iosfwd>         // for ostream
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for pair
+#include <vector>         // for vector
+
+#include "ftxui/component/event.hpp"  // for Event
+#include "ftxui/screen/cell.hpp"      // for Cell
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/util/export.hpp"
+
+namespace ftxui {
+
+/// @brief Write a compact binary recording of a session: the frames drawn,
+/// and the events received, with their timestamps.
+///
+/// The first frame is stored entirely. The next ones only store the cells
+/// that changed since the previous frame.
+///
+/// It is used by App::RecordTo, and read back by RecordingReader.
+///
+/// @ingroup component
+class FTXUI_EXPORT(COMPONENT) RecordingWriter {
+ public:
+  explicit RecordingWriter(std::ostream& out);
+
+  // Record a frame, once drawn.
+  void Frame(const Screen& screen);
+  // Record an event, before it is handled.
+  void Event(const ftxui::Event& event);
+
+  // Number of bytes written.
+  size_t size() const { return size_; }
+
+ private:
+  void Begin(char type);
+  void End();
+  void WriteCell(const Cell& cell,
+                 uint32_t link,
+                 Cell& previous,
+                 uint32_t& previous_link);
+  uint32_t HyperlinkId(const std::string& link);
+
+  std::ostream& out_;
+  std::string buffer_;
+  size_t size_ = 0;
+  std::chrono::steady_clock::time_point start_;
+  std::chrono::microseconds time_{0};
+
+  // The last frame recorded. The hyperlinks of the cells are stored apart, by
+  // their id in the recording.
+  int dimx_ = 0;
+  int dimy_ = 0;
+  std::vector<Cell> cells_;
+  std::vector<uint32_t> links_;
+  // The [begin, end) ranges of cells modified by the current frame.
+  std::vector<std::pair<size_t, size_t>> runs_;
+
+  // The hyperlinks, by id in the recording, minus one.
+  std::vector<std::string> hyperlinks_;
+  std::unordered_map<std::string, uint32_t> hyperlinks_index_;
+  // The number of hyperlinks whose content has been written.
+  size_t hyperlinks_written_ = 0;
+};
+
+/// @brief Read a recording made by RecordingWriter.
+///
+/// The file is memory-mapped when possible. Records are visited in order
+/// using Next(). The current screen is updated by every frame.
+///
+/// ### Example
+///
+/// ```cpp
+/// RecordingReader reader("session.ftxui");
+/// while (reader.Next()) {
+///   if (reader.type() == RecordingReader::Type::Frame) {
+///     Use(reader.screen());
+///   }
+/// }
+/// ```
+///
+/// @ingroup component
+class FTXUI_EXPORT(COMPONENT) RecordingReader {
+ public:
+  enum class Type {
+    Frame,
+    Event,
+  };
+
+  // Open and map a recording file.
+  explicit RecordingReader(const std::string& path);
+  // Read a recording from memory. The data must outlive the reader.
+  RecordingReader(const char* data, size_t size);
+  ~RecordingReader();
+
+  RecordingReader(const RecordingReader&) = delete;
+  RecordingReader& operator=(const RecordingReader&) = delete;
+
+  // Whether the recording was opened and is valid so far.
+  bool ok() const { return ok_; }
+
+  // Advance to the next record. Return false at the end, or on error.
+  bool Next();
+
+  // The current record:
+  Type type() const { return type_; }
+  std::chrono::microseconds time() const { return time_; }
+  size_t record_size() const { return record_size_; }
+  // The screen, as of the last frame read.
+  const Screen& screen() const { return screen_; }
+  // The event, if the current record is an event.
+  const ftxui::Event& event() const { return event_; }
+
+ private:
+  bool Open(std::string_view data);
+  bool ReadFrame();
+  bool ReadEvent();
+  bool ReadCell(Cell& cell,
+                uint32_t& link,
+                Cell& previous,
+                uint32_t& previous_link);
+  void RegisterHyperlinks();
+
+  // The data and the position of the next byte to read.
+  const char* data_ = nullptr;
+  const char* end_ = nullptr;
+  const char* position_ = nullptr;
+
+  // The memory mapping, or the content of the file when it can't be mapped.
+  void* mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+  std::string content_;
+
+  bool ok_ = false;
+  Type type_ = Type::Frame;
+  std::chrono::microseconds time_{0};
+  size_t record_size_ = 0;
+  Screen screen_{0, 0};
+  ftxui::Event event_;
+  // The hyperlinks, by id in the recording, minus one.
+  std::vector<std::string> hyperlinks_;
+  // The id in the recording of the hyperlink of every cell of |screen_|.
+  std::vector<uint32_t> links_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_RECORDING_HPP
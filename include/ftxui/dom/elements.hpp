@@ -13,7 +13,9 @@
 #include "ftxui/dom/direction.hpp"
 #include "ftxui/dom/flexbox_config.hpp"
 #include "ftxui/dom/linear_gradient.hpp"
+#include "ftxui/dom/memo.hpp"
 #include "ftxui/dom/node.hpp"
+#include "ftxui/dom/paragraph_config.hpp"
 #include "ftxui/screen/box.hpp"
 #include "ftxui/screen/color.hpp"
 #include "ftxui/screen/terminal.hpp"
@@ -100,6 +102,8 @@ FTXUI_EXPORT(DOM) Element paragraphAlignLeft(std::string_view text);
 FTXUI_EXPORT(DOM) Element paragraphAlignRight(std::string_view text);
 FTXUI_EXPORT(DOM) Element paragraphAlignCenter(std::string_view text);
 FTXUI_EXPORT(DOM) Element paragraphAlignJustify(std::string_view text);
+FTXUI_EXPORT(DOM)
+Element paragraph(std::string_view text, ParagraphConfig config);
 FTXUI_EXPORT(DOM) Element graph(GraphFunction);
 FTXUI_EXPORT(DOM) Element emptyElement();
 FTXUI_EXPORT(DOM) Element canvas(ConstRef<Canvas>);
@@ -213,6 +217,16 @@ FTXUI_EXPORT(DOM) Decorator reflect(Box& box);
 // Before drawing the |element| clear the pixel below. This is useful in
 // combination with dbox.
 FTXUI_EXPORT(DOM) Element clear_under(Element element);
+// Reuse the element built by |builder|, its layout and its rendering, while
+// |deps| is unchanged. See Memo.
+FTXUI_EXPORT(DOM)
+Element memo(Memo& key, size_t deps, const std::function<Element()>& builder);
+// A list of |count| rows, of |row_height| lines each. Only the visible ones are
+// built by |generator|. Meant to be displayed inside a frame.
+FTXUI_EXPORT(DOM)
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> generator);
 
 // --- Util --------------------------------------------------------------------
 FTXUI_EXPORT(DOM) Element hcenter(Element);
@@ -0,0 +1,119 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_FRAME_ARENA_HPP
+#define FTXUI_DOM_FRAME_ARENA_HPP
+
+#include <cstddef>  // for size_t
+#include <memory>   // for allocate_shared, shared_ptr
+#include <utility>  // for forward
+#include <vector>   // for vector
+
+#include "ftxui/util/export.hpp"  // for FTXUI_EXPORT
+
+namespace ftxui {
+
+/// @brief A memory arena the elements are allocated from, while it is active
+/// on the current thread. Allocating from it is a pointer bump, instead of a
+/// call to the heap allocator.
+///
+/// The memory is handed out in blocks. A block is reused once every element
+/// allocated from it is released, after a Reset(). Elements outliving the
+/// frame, e.g. kept by a `memo`, stay valid: their block isn't reused until
+/// they are released, even after the arena is destroyed.
+///
+/// Example:
+/// ```cpp
+/// FrameArena arena;
+/// while (true) {
+///   arena.Reset();
+///   FrameArena::Scope scope(arena);
+///   Element document = BuildDocument();  // Allocated from |arena|.
+///   Render(screen, document);
+/// }
+/// ```
+///
+/// @see App::UseFrameArena
+/// @ingroup dom
+class FTXUI_EXPORT(DOM) FrameArena {
+ public:
+  FrameArena();
+  ~FrameArena();
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+
+  // Start a new frame. The blocks whose allocations were all released are
+  // reused.
+  void Reset();
+
+  // The number of blocks of memory owned by the arena.
+  size_t BlockCount() const { return blocks_.size(); }
+
+  // Make |arena| the one used by the current thread, until the end of the
+  // scope.
+  class FTXUI_EXPORT(DOM) Scope {
+   public:
+    explicit Scope(FrameArena& arena);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    FrameArena* previous_;
+  };
+
+  // Allocate |size| bytes from the arena active on the current thread, or from
+  // the heap when there are none. They are released using Deallocate().
+  static void* Allocate(size_t size);
+  static void Deallocate(void* pointer) noexcept;
+
+  struct Block;
+
+ private:
+  void* AllocateFromBlock(size_t size);
+  Block* NextBlock();
+
+  std::vector<Block*> blocks_;
+  Block* block_ = nullptr;  // The block allocated from.
+  size_t used_ = 0;         // The bytes used in |block_|.
+};
+
+/// @brief A standard allocator using FrameArena::Allocate.
+/// @ingroup dom
+template <typename T>
+struct FrameArenaAllocator {
+  using value_type = T;
+
+  FrameArenaAllocator() = default;
+  template <typename U>
+  FrameArenaAllocator(const FrameArenaAllocator<U>& /*unused*/) {}  // NOLINT
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(FrameArena::Allocate(n * sizeof(T)));
+  }
+  void deallocate(T* pointer, size_t /*unused*/) noexcept {
+    FrameArena::Deallocate(pointer);
+  }
+
+  template <typename U>
+  bool operator==(const FrameArenaAllocator<U>& /*unused*/) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const FrameArenaAllocator<U>& /*unused*/) const {
+    return false;
+  }
+};
+
+/// @brief Same as std::make_shared, allocating from the FrameArena active on
+/// the current thread, if any. The elements are built using it.
+/// @ingroup dom
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeNode(Args&&... args) {
+  return std::allocate_shared<T>(FrameArenaAllocator<T>(),
+                                 std::forward<Args>(args)...);
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_FRAME_ARENA_HPP
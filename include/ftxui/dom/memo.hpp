@@ -0,0 +1,46 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_MEMO_HPP
+#define FTXUI_DOM_MEMO_HPP
+
+#include <memory>  // for shared_ptr
+
+#include "ftxui/util/export.hpp"  // for FTXUI_EXPORT
+
+namespace ftxui {
+
+/// @brief The cache of a `memo` element, kept from one frame to the next.
+///
+/// It is typically a member of the component rendering the element:
+/// ```cpp
+/// class Sidebar : public ComponentBase {
+///   Element OnRender() override {
+///     return memo(memo_, version_, [&] { return RenderEntries(); });
+///   }
+///   Memo memo_;
+///   size_t version_ = 0;  // Incremented when the entries change.
+/// };
+/// ```
+///
+/// A Memo must be used by at most one element per frame. Copies share the
+/// same cache.
+///
+/// @ingroup dom
+class FTXUI_EXPORT(DOM) Memo {
+ public:
+  Memo();
+
+  // Forget the cached element. The next frame builds it again.
+  void Invalidate();
+
+ private:
+  struct Internal;
+  std::shared_ptr<Internal> internal_;
+
+  friend class MemoNode;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_MEMO_HPP
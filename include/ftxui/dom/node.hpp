@@ -67,13 +67,22 @@ class FTXUI_EXPORT(DOM) Node {
 
   // Layout may not resolve within a single iteration for some elements. This
   // allows them to request additional iterations. This signal must be
-  // forwarded to children at least once.
+  // forwarded to children at least once. The elements whose requirement
+  // depends on their box must request one whenever it changes.
   struct Status {
     int iteration = 0;
     bool need_iteration = false;
   };
   virtual void Check(Status* status);
 
+  // Same as ComputeRequirement(), SetBox() and Check(), skipped when the
+  // layout of this element is already resolved: it didn't request another
+  // iteration, and its box is unchanged. Used by the parents, so that only the
+  // subtrees requesting additional iterations are laid out again.
+  void ComputeRequirementIfNeeded();
+  void SetBoxIfNeeded(Box box);
+  void CheckIfNeeded(Status* status);
+
   // ABI Reserve:
   virtual void Reserved1();
   virtual void Reserved2();
@@ -90,12 +99,18 @@ class FTXUI_EXPORT(DOM) Node {
   Elements children_;
   Requirement requirement_;
   Box box_;
+
+ private:
+  bool layout_resolved_ = false;
 };
 
 FTXUI_EXPORT(DOM) void Render(Screen& screen, const Element& element);
 FTXUI_EXPORT(DOM) void Render(Screen& screen, Node* node);
 FTXUI_EXPORT(DOM)
 void Render(Screen& screen, Node* node, Selection& selection);
+// Lay out |node| within |box|, iterating until its layout is resolved. Used by
+// Render, and by the elements laying out children they build on demand.
+FTXUI_EXPORT(DOM) void LayoutNode(Node* node, Box box);
 FTXUI_EXPORT(DOM)
 std::string GetNodeSelectedContent(Screen& screen,
                                    Node* node,
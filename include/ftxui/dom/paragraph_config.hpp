@@ -0,0 +1,49 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_PARAGRAPH_CONFIG_HPP
+#define FTXUI_DOM_PARAGRAPH_CONFIG_HPP
+
+#include <cstdint>
+
+#include "ftxui/util/export.hpp"  // for FTXUI_EXPORT
+
+namespace ftxui {
+
+/// @brief ParagraphConfig defines how a `paragraph` is broken into lines, and
+/// how they are aligned.
+///
+/// @ingroup dom
+struct FTXUI_EXPORT(DOM) ParagraphConfig {
+  /// How the lines are aligned horizontally.
+  enum class Align : uint8_t {
+    Left,     ///< The lines are aligned on the left.
+    Right,    ///< The lines are aligned on the right.
+    Center,   ///< The lines are centered.
+    Justify,  ///< The words are spread over the whole width. The last line of
+              ///< every paragraph is aligned on the left.
+  };
+  Align align = Align::Left;
+
+  /// Where the lines are broken.
+  enum class Wrap : uint8_t {
+    Greedy,    ///< Put as many words as possible on every line.
+    Balanced,  ///< Minimize the sum of the squared empty space at the end of
+               ///< the lines, except the last one. This is the Knuth-Plass
+               ///< algorithm, without hyphenation.
+  };
+  Wrap wrap = Wrap::Greedy;
+
+  // Constructor pattern. For chained use like:
+  // ```
+  // ParagraphConfig()
+  //    .Set(ParagraphConfig::Align::Justify)
+  //    .Set(ParagraphConfig::Wrap::Balanced);
+  // ```
+  ParagraphConfig& Set(ParagraphConfig::Align);
+  ParagraphConfig& Set(ParagraphConfig::Wrap);
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_PARAGRAPH_CONFIG_HPP
@@ -4,8 +4,10 @@
 #ifndef FTXUI_DOM_TABLE
 #define FTXUI_DOM_TABLE
 
-#include <string>  // for string
-#include <vector>  // for vector
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <string>      // for string
+#include <vector>      // for vector
 
 #include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT, Decorator
 #include "ftxui/util/export.hpp"
@@ -33,6 +35,19 @@ class TableSelection;
 /// std::move(table).Render();
 /// ```
 ///
+/// A large table can be built from a function returning its cells. They are
+/// built only when visible, inside a `frame`:
+/// ```cpp
+/// auto table = Table(50, 100000, [&](int column, int row) {
+///   return text(data[row][column]);
+/// });
+/// table.SampleRows(100);
+/// table.SelectAll().Border(LIGHT);
+///
+/// // On every frame:
+/// table.Render() | focusPosition(0, selected) | yframe;
+/// ```
+///
 /// @ingroup dom
 class FTXUI_EXPORT(DOM) Table {
  public:
@@ -40,6 +55,10 @@ class FTXUI_EXPORT(DOM) Table {
   explicit Table(const std::vector<std::vector<std::string>>&);
   explicit Table(std::vector<std::vector<Element>>);
   Table(std::initializer_list<std::vector<std::string>> init);
+  Table(int columns,
+        int rows,
+        std::function<Element(int column, int row)> cell);
+  void SampleRows(int count);
   TableSelection SelectAll();
   TableSelection SelectCell(int column, int row);
   TableSelection SelectRow(int row_index);
@@ -54,8 +73,17 @@ class FTXUI_EXPORT(DOM) Table {
 
  private:
   void Initialize(std::vector<std::vector<Element>>);
+  void Apply(int x_min,
+             int x_max,
+             int y_min,
+             int y_max,
+             const std::function<bool(int x, int y)>& filter,
+             const Decorator& decorator,
+             bool line = false);
   friend TableSelection;
+  struct Large;
   std::vector<std::vector<Element>> elements_;
+  std::shared_ptr<Large> large_;  // Only for the tables built on demand.
   int input_dim_x_ = 0;
   int input_dim_y_ = 0;
   int dim_x_ = 0;
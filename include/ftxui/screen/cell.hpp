@@ -4,9 +4,9 @@
 #ifndef FTXUI_SCREEN_CELL_HPP
 #define FTXUI_SCREEN_CELL_HPP
 
-#include <cstdint>                 // for uint8_t
-#include <string>                  // for string, basic_string, allocator
+#include <cstdint>                 // for uint16_t
 #include "ftxui/screen/color.hpp"  // for Color, Color::Default
+#include "ftxui/screen/glyph.hpp"  // for Glyph
 #include "ftxui/util/export.hpp"
 
 namespace ftxui {
@@ -42,11 +42,11 @@ struct FTXUI_EXPORT(SCREEN) Cell {
   // The hyperlink associated with the cell.
   // 0 is the default value, meaning no hyperlink.
   // It's an index for accessing Screen meta data
-  uint8_t hyperlink = 0;
+  uint16_t hyperlink = 0;
 
   // The graphemes stored into the cell. To support combining characters,
   // like: a?, this can potentially contain multiple codepoints.
-  std::string character = "";
+  Glyph character;
 
   // Colors:
   Color background_color = Color::Default;
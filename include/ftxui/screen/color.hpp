@@ -4,6 +4,7 @@
 #ifndef FTXUI_SCREEN_COLOR_HPP
 #define FTXUI_SCREEN_COLOR_HPP
 
+#include <cstddef>  // for size_t
 #include <cstdint>  // for uint8_t
 #include <string>   // for string
 
@@ -17,6 +18,8 @@
 
 namespace ftxui {
 
+class OutputSink;
+
 /// @brief Color is a class that represents a color in the terminal user
 /// interface.
 ///
@@ -44,6 +47,14 @@ class FTXUI_EXPORT(SCREEN) Color {
   static Color Interpolate(float t, const Color& a, const Color& b);
   static Color Blend(const Color& lhs, const Color& rhs);
 
+  // Batched versions, processing a whole row of colors at once:
+  static void Interpolate(const float* t,
+                          const Color& a,
+                          const Color& b,
+                          Color* out,
+                          size_t size);
+  static void Blend(Color* lhs, const Color& rhs, size_t size);
+
   //---------------------------
   // List of colors:
   //---------------------------
@@ -321,9 +332,26 @@ class FTXUI_EXPORT(SCREEN) Color {
 
   std::string Print(bool is_background_color) const;
   void PrintTo(std::string& out, bool is_background_color) const;
+  void PrintTo(OutputSink& out, bool is_background_color) const;
   bool IsOpaque() const { return alpha_ == 255; }
+  // A hash of the color, equal for colors comparing equal.
+  size_t Hash() const {
+    return static_cast<size_t>(type_) | static_cast<size_t>(red_) << 8 |
+           static_cast<size_t>(green_) << 16 |
+           static_cast<size_t>(blue_) << 24;  // NOLINT
+  }
+
+  // The nearest color of the 256 colors palette, for a TrueColor color. Other
+  // colors are returned unchanged.
+  Color ToPalette256() const;
 
  private:
+  friend struct ColorCodec;  // Serialization of the recordings.
+
+  void ToLinear(float& red, float& green, float& blue) const;
+  template <typename Output>
+  void PrintToInternal(Output& out, bool is_background_color) const;
+
   enum class ColorType : uint8_t {
     Palette1,
     Palette16,
@@ -0,0 +1,181 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_GLYPH_HPP
+#define FTXUI_SCREEN_GLYPH_HPP
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t, uint32_t
+#include <iosfwd>       // for ostream
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/util/export.hpp"
+
+namespace ftxui {
+
+/// @brief The grapheme displayed by a Cell, stored in 5 bytes.
+///
+/// Graphemes up to 4 bytes (ASCII, and any single codepoint) are stored
+/// inline. Longer ones (combining characters, emoji sequences, ...) are
+/// interned in a global pool, and referred to by a 32-bit id. The pool counts
+/// the references to them, and reclaims the ones no longer used.
+///
+/// It behaves like a read-only std::string, and can be assigned from any
+/// string. Its display width is computed on assignment, so that printing it
+/// never requires decoding UTF-8.
+///
+/// @ingroup screen
+class FTXUI_EXPORT(SCREEN) Glyph {
+ public:
+  Glyph() = default;
+  // NOLINTBEGIN
+  Glyph(std::string_view glyph) { Assign(glyph); }
+  Glyph(const std::string& glyph) { Assign(glyph); }
+  Glyph(const char* glyph) { Assign(glyph); }
+  // NOLINTEND
+
+  Glyph(const Glyph& other) noexcept { Copy(other); }
+  Glyph(Glyph&& other) noexcept { Steal(other); }
+  Glyph& operator=(const Glyph& other) noexcept {
+    if (this != &other) {
+      const Glyph previous = std::move(*this);
+      Copy(other);
+    }
+    return *this;
+  }
+  Glyph& operator=(Glyph&& other) noexcept {
+    if (this != &other) {
+      const Glyph previous = std::move(*this);
+      Steal(other);
+    }
+    return *this;
+  }
+  ~Glyph() {
+    if (flags_ & kInterned) {
+      Release();
+    }
+  }
+
+  Glyph& operator=(std::string_view glyph) {
+    Assign(glyph);
+    return *this;
+  }
+  Glyph& operator=(const std::string& glyph) {
+    Assign(glyph);
+    return *this;
+  }
+  Glyph& operator=(const char* glyph) {
+    Assign(glyph);
+    return *this;
+  }
+
+  // Append to the grapheme, for instance a combining character.
+  Glyph& operator+=(std::string_view suffix) {
+    std::string glyph(str());
+    glyph += suffix;
+    Assign(glyph);
+    return *this;
+  }
+
+  // Access the UTF-8 encoded grapheme.
+  std::string_view str() const {
+    if (!(flags_ & kInterned)) {
+      return {bytes_, static_cast<size_t>(flags_ & kSizeMask)};
+    }
+    return Interned();
+  }
+  // NOLINTBEGIN
+  operator std::string_view() const { return str(); }
+  operator std::string() const { return std::string(str()); }
+  // NOLINTEND
+
+  const char* data() const { return str().data(); }
+  size_t size() const { return str().size(); }
+  bool empty() const { return flags_ == 0; }
+  // Whether the glyph occupies two columns. Computed once, on assignment.
+  bool full_width() const { return (flags_ & kFullWidth) != 0; }
+  char operator[](size_t index) const { return str()[index]; }
+
+  // Two glyphs are equal if and only if their representation is equal.
+  friend bool operator==(const Glyph& a, const Glyph& b) {
+    return a.flags_ == b.flags_ && a.bytes_[0] == b.bytes_[0] &&
+           a.bytes_[1] == b.bytes_[1] && a.bytes_[2] == b.bytes_[2] &&
+           a.bytes_[3] == b.bytes_[3];
+  }
+  friend bool operator!=(const Glyph& a, const Glyph& b) { return !(a == b); }
+
+  // Comparison with strings.
+  friend bool operator==(const Glyph& a, std::string_view b) {
+    return a.str() == b;
+  }
+  friend bool operator==(const Glyph& a, const std::string& b) {
+    return a.str() == b;
+  }
+  friend bool operator==(const Glyph& a, const char* b) {
+    return a.str() == b;
+  }
+  friend bool operator==(std::string_view a, const Glyph& b) { return b == a; }
+  friend bool operator==(const std::string& a, const Glyph& b) {
+    return b == a;
+  }
+  friend bool operator==(const char* a, const Glyph& b) { return b == a; }
+  friend bool operator!=(const Glyph& a, std::string_view b) {
+    return !(a == b);
+  }
+  friend bool operator!=(const Glyph& a, const std::string& b) {
+    return !(a == b);
+  }
+  friend bool operator!=(const Glyph& a, const char* b) { return !(a == b); }
+  friend bool operator!=(std::string_view a, const Glyph& b) {
+    return !(a == b);
+  }
+  friend bool operator!=(const std::string& a, const Glyph& b) {
+    return !(a == b);
+  }
+  friend bool operator!=(const char* a, const Glyph& b) { return !(a == b); }
+
+  // The number of graphemes currently interned. For tests.
+  static size_t InternedCount();
+
+ private:
+  void Assign(std::string_view glyph);
+  std::string_view Interned() const;
+  void Acquire() const;
+  void Release() const;
+
+  void Copy(const Glyph& other) {
+    bytes_[0] = other.bytes_[0];
+    bytes_[1] = other.bytes_[1];
+    bytes_[2] = other.bytes_[2];
+    bytes_[3] = other.bytes_[3];
+    flags_ = other.flags_;
+    if (flags_ & kInterned) {
+      Acquire();
+    }
+  }
+  void Steal(Glyph& other) {
+    bytes_[0] = other.bytes_[0];
+    bytes_[1] = other.bytes_[1];
+    bytes_[2] = other.bytes_[2];
+    bytes_[3] = other.bytes_[3];
+    flags_ = other.flags_;
+    other.bytes_[0] = other.bytes_[1] = other.bytes_[2] = other.bytes_[3] = 0;
+    other.flags_ = 0;
+  }
+
+  static constexpr uint8_t kSizeMask = 0b0000'0111;
+  static constexpr uint8_t kInterned = 0b0000'1000;
+  static constexpr uint8_t kFullWidth = 0b0001'0000;
+
+  // Either the inline UTF-8 bytes, zero padded, or the id in the pool.
+  char bytes_[4] = {0, 0, 0, 0};  // NOLINT
+  uint8_t flags_ = 0;
+};
+
+FTXUI_EXPORT(SCREEN) std::ostream& operator<<(std::ostream& os, const Glyph&);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_GLYPH_HPP
@@ -0,0 +1,76 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_OUTPUT_SINK_HPP
+#define FTXUI_SCREEN_OUTPUT_SINK_HPP
+
+#include <cstddef>      // for size_t
+#include <functional>   // for function
+#include <string_view>  // for string_view
+
+#include "ftxui/util/export.hpp"  // for FTXUI_EXPORT
+
+namespace ftxui {
+
+/// @brief A chunked writer, accumulating the output of Screen::ToString into
+/// a fixed buffer provided by the caller, and flushing it whenever it is full.
+///
+/// This allows streaming large frames with bounded memory. Data larger than
+/// the buffer is passed through directly. With a zero capacity, every write is
+/// passed through.
+///
+/// ### Example
+///
+/// ```cpp
+/// char buffer[4096];
+/// OutputSink sink(buffer, sizeof(buffer), STDOUT_FILENO);
+/// screen.ToString(sink);
+/// sink.Flush();
+/// ```
+///
+/// @ingroup screen
+class FTXUI_EXPORT(SCREEN) OutputSink {
+ public:
+  using Callback = std::function<void(std::string_view)>;
+
+  // Flush the buffer into |callback|.
+  OutputSink(char* buffer, size_t capacity, Callback callback);
+  // Flush the buffer into the file descriptor |fd|. Partial writes are
+  // retried, and non-blocking file descriptors are waited for.
+  OutputSink(char* buffer, size_t capacity, int fd);
+  // Flush what remains.
+  ~OutputSink();
+
+  OutputSink(const OutputSink&) = delete;
+  OutputSink& operator=(const OutputSink&) = delete;
+
+  OutputSink& operator+=(std::string_view data);
+  OutputSink& operator+=(char c) {
+    if (size_ == capacity_) {
+      Flush();
+      if (capacity_ == 0) {
+        return *this += std::string_view(&c, 1);
+      }
+    }
+    buffer_[size_++] = c;
+    written_++;
+    return *this;
+  }
+
+  // Pass the buffered data to the destination.
+  void Flush();
+
+  // Number of bytes written since the construction.
+  size_t size() const { return written_; }
+
+ private:
+  char* buffer_;
+  size_t capacity_;
+  size_t size_ = 0;
+  size_t written_ = 0;
+  Callback callback_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_OUTPUT_SINK_HPP
@@ -4,14 +4,18 @@
 #ifndef FTXUI_SCREEN_SCREEN_HPP
 #define FTXUI_SCREEN_SCREEN_HPP
 
-#include <cstdint>     // for uint8_t
-#include <functional>  // for function
-#include <string>      // for string, basic_string, allocator
-#include <vector>      // for vector
-
-#include "ftxui/screen/surface.hpp"   // for Surface
-#include "ftxui/screen/terminal.hpp"  // for Dimensions
-#include "ftxui/util/export.hpp"      // for FTXUI_EXPORT
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint8_t, uint16_t
+#include <functional>     // for function
+#include <string>         // for string, basic_string, allocator
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_multimap
+#include <vector>         // for vector
+
+#include "ftxui/screen/output_sink.hpp"  // for OutputSink
+#include "ftxui/screen/surface.hpp"      // for Surface
+#include "ftxui/screen/terminal.hpp"     // for Dimensions
+#include "ftxui/util/export.hpp"         // for FTXUI_EXPORT
 
 namespace ftxui {
 
@@ -41,13 +45,35 @@ class FTXUI_EXPORT(SCREEN) Screen : public Surface {
   std::string ToString() const;
   void ToString(std::string& ss) const;
 
+  // Update a terminal currently displaying |previous| into this screen, by
+  // printing only the cells that changed.
+  void ToString(std::string& ss,
+                const Screen& previous,
+                bool scroll = false) const;
+
+  // Same as above, streaming the output into |out| with bounded memory.
+  void ToString(OutputSink& out) const;
+  void ToString(OutputSink& out,
+                const Screen& previous,
+                bool scroll = false) const;
+
   // Print the Screen on to the terminal.
   void Print() const;
 
-  // Fill the screen with space and reset any screen state, like hyperlinks, and
-  // cursor
+  // Serialize large screens using up to |threads| threads, in ToString. The
+  // output is unchanged. This is disabled by default.
+  void SetSerializationThreads(int threads) { serialization_threads_ = threads; }
+  int serialization_threads() const { return serialization_threads_; }
+
+  // Fill the screen with space and reset any screen state, like the cursor.
+  // Registered hyperlinks are kept, to be reused by the next frame, unless more
+  // than 32767 are registered. They are then all forgotten.
   void Clear();
 
+  // Exchange the cells of two screens, and the hyperlinks they refer to,
+  // without copying them.
+  void Swap(Screen& other);
+
   // Move the terminal cursor n-lines up with n = dimy().
   std::string ResetPosition(bool clear = false) const;
   void ResetPosition(std::string& ss, bool clear = false) const;
@@ -85,8 +111,10 @@ class FTXUI_EXPORT(SCREEN) Screen : public Surface {
 
   // Store an hyperlink in the screen. Return the id of the hyperlink. The id is
   // used to identify the hyperlink when the user click on it.
-  uint8_t RegisterHyperlink(std::string_view link);
-  const std::string& Hyperlink(uint8_t id) const;
+  // At most 65535 distinct hyperlinks can be registered between two Clear().
+  // Beyond, 0 is returned: the cells get no hyperlink.
+  uint16_t RegisterHyperlink(std::string_view link);
+  const std::string& Hyperlink(uint16_t id) const;
 
   using SelectionStyle = std::function<void(Cell&)>;
   const SelectionStyle& GetSelectionStyle() const;
@@ -95,9 +123,20 @@ class FTXUI_EXPORT(SCREEN) Screen : public Surface {
  protected:
   Cursor cursor_;
   std::vector<std::string> hyperlinks_ = {""};
+  // Index of |hyperlinks_|, by hash of the link.
+  std::unordered_multimap<size_t, uint16_t> hyperlinks_index_;
 
   // The current selection style. This is overridden by various dom elements.
   SelectionStyle selection_style_ = [](Cell& cell) { cell.inverted ^= true; };
+
+  int serialization_threads_ = 1;
+
+ private:
+  // Implementations of ToString, for both std::string and OutputSink.
+  template <typename Output>
+  void Serialize(Output& out, int y_begin, int y_end) const;
+  template <typename Output>
+  void SerializeDiff(Output& out, const Screen& previous, bool scroll) const;
 };
 
 }  // namespace ftxui
@@ -4,12 +4,14 @@
 #ifndef FTXUI_SCREEN_SURFACE_HPP
 #define FTXUI_SCREEN_SURFACE_HPP
 
-#include <string>  // for string, basic_string, allocator
-#include <vector>  // for vector
+#include <string>   // for string, basic_string, allocator
+#include <utility>  // for pair
+#include <vector>   // for vector
 
 #include "ftxui/screen/box.hpp"   // for Box
-#include "ftxui/screen/cell.hpp"  // for Cell
-#include "ftxui/util/export.hpp"  // for FTXUI_EXPORT
+#include "ftxui/screen/cell.hpp"   // for Cell
+#include "ftxui/screen/glyph.hpp"  // for Glyph
+#include "ftxui/util/export.hpp"   // for FTXUI_EXPORT
 
 namespace ftxui {
 
@@ -32,8 +34,8 @@ class FTXUI_EXPORT(SCREEN) Surface {
   Surface& operator=(const Surface&) = default;
 
   // Access a character in the grid at a given position.
-  std::string& at(int x, int y);
-  const std::string& at(int x, int y) const;
+  Glyph& at(int x, int y);
+  const Glyph& at(int x, int y) const;
 
   // Access a cell (Cell) in the grid at a given position.
   Cell& CellAt(int x, int y);
@@ -50,6 +52,22 @@ class FTXUI_EXPORT(SCREEN) Surface {
   // Fill the surface with space and default style
   void Clear();
 
+  // Exchange the cells of two surfaces, without copying them.
+  void Swap(Surface& other);
+
+  // Damage tracking. When enabled, the cells accessed for writing using at()
+  // and CellAt() are recorded, until the next Clear() or ResetDamage().
+  // Clear(), Screen::ApplyShader() and Screen::ToString() then only visit
+  // them.
+  void TrackDamage(bool enable = true);
+  bool IsTrackingDamage() const { return track_damage_; }
+  // The smallest box containing the damaged cells, empty if there are none.
+  // Without tracking, this is the whole surface.
+  Box Damage() const;
+  // The damaged cells of the row |y|, as a box of height 1.
+  Box RowDamage(int y) const;
+  void ResetDamage();
+
   // ABI Reserve:
   virtual void Reserved1();
   virtual void Reserved2();
@@ -66,9 +84,23 @@ class FTXUI_EXPORT(SCREEN) Surface {
   Cell& FastCellAt(int x, int y);
   const Cell& FastCellAt(int x, int y) const;
 
+  // Change the dimensions. The cells are cleared, and their capacity kept.
+  void Resize(int dimx, int dimy);
+
+  // Whether the cells outside of the damage are known to be blank. The
+  // consumers of the damage can then skip them.
+  bool IsBlankOutsideDamage() const {
+    return track_damage_ && blank_outside_damage_;
+  }
+
   int dimx_;
   int dimy_;
   std::vector<Cell> cells_;
+
+  // For each row, the [first, last] columns damaged. Empty when first > last.
+  std::vector<std::pair<int, int>> damage_;
+  bool track_damage_ = false;
+  bool blank_outside_damage_ = false;
 };
 
 }  // namespace ftxui
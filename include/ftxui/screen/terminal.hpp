@@ -61,6 +61,11 @@ class FTXUI_EXPORT(SCREEN) Quirks {
   bool ComponentAscii() const;
   void SetComponentAscii(bool v);
 
+  /// @brief Whether the terminal supports synchronized output (DEC mode
+  /// 2026). Frames are then displayed atomically, without tearing.
+  bool SynchronizedOutput() const;
+  void SetSynchronizedOutput(bool v);
+
   /// @brief The level of color support of the terminal.
   Color ColorSupport() const;
   void SetColorSupport(Color v);
@@ -72,6 +77,20 @@ class FTXUI_EXPORT(SCREEN) Quirks {
 FTXUI_EXPORT(SCREEN) Quirks GetQuirks();
 FTXUI_EXPORT(SCREEN) void SetQuirks(const Quirks& quirks);
 
+/// @brief A plain, read-only copy of the current Quirks.
+///
+/// Unlike GetQuirks(), reading it doesn't allocate. Use it on the rendering
+/// path. It is updated by SetQuirks() and SetColorSupport().
+/// @ingroup screen
+struct QuirksSnapshot {
+  bool block_characters = true;
+  bool cursor_hiding = true;
+  bool component_ascii = false;
+  bool synchronized_output = false;
+  Color color_support = Palette256;
+};
+FTXUI_EXPORT(SCREEN) const QuirksSnapshot& GetQuirksSnapshot();
+
 /// @brief TerminalInfo is a structure that contains information about the
 /// terminal.
 /// @ingroup screen
@@ -13,6 +13,7 @@ module;
 #include <ftxui/component/loop.hpp>
 #include <ftxui/component/mouse.hpp>
 #include <ftxui/component/receiver.hpp>
+#include <ftxui/component/recording.hpp>
 #include <ftxui/component/screen_interactive.hpp>
 #include <ftxui/component/task.hpp>
 
@@ -46,6 +47,8 @@ export namespace ftxui {
     using ftxui::MenuOption;
     using ftxui::Mouse;
     using ftxui::RadioboxOption;
+    using ftxui::RecordingReader;
+    using ftxui::RecordingWriter;
     using ftxui::ResizableSplitOption;
     using ftxui::Screen;
     using ftxui::SliderOption;
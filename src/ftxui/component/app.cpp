@@ -11,11 +11,13 @@
 #include <ftxui/component/app.hpp>
 #include <ftxui/component/task.hpp>  // for Task, Closure, AnimationTask
 #include <ftxui/screen/screen.hpp>  // for Cell, Screen::Cursor, Screen, Screen::Cursor::Hidden
+#include <fstream>           // for ofstream
 #include <functional>        // for function
 #include <initializer_list>  // for initializer_list
 #include <iostream>  // for cout, ostream, operator<<, basic_ostream, endl, flush
 #include <map>
 #include <memory>
+#include <optional>  // for optional
 #include <stack>  // for stack
 #include <string>
 #include <string_view>
@@ -27,15 +29,19 @@
 #include <vector>   // for vector
 
 #include "ftxui/component/animation.hpp"  // for TimePoint, Clock, Duration, Params, RequestAnimationFrame
+#include "ftxui/component/bandwidth_monitor.hpp"  // for BandwidthMonitor
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse, CapturedMouseInterface
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/component/loop.hpp"            // for Loop
 #include "ftxui/component/multi_receiver_buffer.hpp"
+#include "ftxui/component/recording.hpp"  // for RecordingWriter
 #include "ftxui/component/task_runner.hpp"
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/dom/frame_arena.hpp"                  // for FrameArena
 #include "ftxui/dom/node.hpp"                         // for Node, Render
 #include "ftxui/screen/cell.hpp"                      // for Cell
+#include "ftxui/screen/output_sink.hpp"               // for OutputSink
 #include "ftxui/screen/terminal.hpp"                  // for Dimensions, Size
 #include "ftxui/screen/util.hpp"                      // for util::clamp
 #include "ftxui/util/autoreset.hpp"                   // for AutoReset
@@ -127,6 +133,11 @@ struct App::Internal {
   bool handle_piped_input_ = true;
   bool is_stdin_a_tty_ = false;
   bool is_stdout_a_tty_ = false;
+  // Whether frames are wrapped into synchronized update sequences.
+  bool synchronized_output_ = false;
+  // The terminal size, cached until the terminal is resized.
+  Dimensions terminal_size_;
+  bool terminal_size_valid_ = false;
   // File descriptor for /dev/tty, used for piped input handling.
   int tty_fd_ = -1;
 
@@ -172,7 +183,36 @@ struct App::Internal {
   task::TaskRunner task_runner;
   std::chrono::time_point<std::chrono::steady_clock> last_char_time =
       std::chrono::steady_clock::now();
-  std::string output_buffer;
+
+  // The output to the terminal. It is accumulated into a fixed buffer, and
+  // written to stdout when full or flushed. In the common case, a frame is
+  // sent using a single write.
+  // |output_flushed_| and |output_blocked_| are the bytes written at the last
+  // TerminalFlush, and the time spent blocked writing since then.
+  size_t output_flushed_ = 0;
+  std::chrono::steady_clock::duration output_blocked_{};
+  std::array<char, 1 << 16> output_buffer_;  // NOLINT
+  OutputSink output_{output_buffer_.data(), output_buffer_.size(),
+                     [this](std::string_view data) { TerminalWrite(data); }};
+
+  // The recording of the session, if enabled. See App::RecordTo.
+  std::unique_ptr<std::ofstream> recording_file_;
+  std::unique_ptr<RecordingWriter> recording_;
+
+  // The frame currently displayed by the terminal. Used to print only the
+  // cells that changed. Emptied when the terminal content can't be trusted.
+  Screen previous_frame_{0, 0};
+
+  // The output throughput. See App::AdaptToBandwidth.
+  BandwidthMonitor bandwidth_;
+  bool adapt_to_bandwidth_ = false;
+  bool downgrade_colors_ = false;
+  bool draw_scheduled_ = false;
+  // Whether a frame is held back, waiting for the terminal to keep up.
+  bool frame_pending_ = false;
+
+  // The memory the elements are allocated from. See App::UseFrameArena.
+  std::unique_ptr<FrameArena> frame_arena_;
 
   class ThrottledRequest {
    public:
@@ -261,10 +301,13 @@ struct App::Internal {
   void HandleTask(Component component, Task& task);
   bool HandleSelection(bool handled, Event event);
   void Draw(Component component);
+  void InvalidateFrame();
+  Dimensions TerminalSize();
   std::string ResetCursorPosition();
   void RequestCursorPosition(bool force = false);
   void TerminalSend(std::string_view);
   void TerminalFlush();
+  void TerminalWrite(std::string_view);
   void InstallPipedInputHandling();
   void InstallTerminalInfo();
   void Signal(int signal);
@@ -315,6 +358,7 @@ enum class DECMode : std::uint16_t {
   kMouseUrxvtMode = 1015,
   kMouseSgrPixelsMode = 1016,
   kAlternateScreen = 1049,
+  kSynchronizedOutput = 2026,
 };
 
 // Device Status Report (DSR) {
@@ -521,8 +565,8 @@ void ExecuteSignalHandlers() {
     App::Private::Signal(*g_active_screen, SIGTSTP);
   }
 
-  int signal_resize_count = g_signal_resize_count.exchange(0);
-  while (signal_resize_count--) {
+  // A storm of resize signals is handled only once.
+  if (g_signal_resize_count.exchange(0) != 0) {
     App::Private::Signal(*g_active_screen, SIGWINCH);
   }
 #endif
@@ -569,6 +613,9 @@ void App::Internal::ExitNow() {
 
 void App::Internal::Install() {
   frame_valid_ = false;
+  terminal_size_valid_ = false;
+  previous_frame_ = Screen(0, 0);
+  previous_frame_.TrackDamage();
 
   // Flush the buffer for stdout to ensure whatever the user has printed before
   // is fully applied before we start modifying the terminal configuration. This
@@ -752,9 +799,8 @@ void App::Internal::PreMain() {
     // Reset cursor position to the top of the screen and clear the screen.
     suspended_screen_->internal_->TerminalSend(
         suspended_screen_->internal_->ResetCursorPosition());
-    suspended_screen_->ResetPosition(
-        suspended_screen_->internal_->output_buffer,
-        /*clear=*/true);
+    suspended_screen_->internal_->TerminalSend(
+        suspended_screen_->ResetPosition(/*clear=*/true));
     suspended_screen_->dimx_ = 0;
     suspended_screen_->dimy_ = 0;
 
@@ -778,7 +824,7 @@ void App::Internal::PostMain() {
   // Restore suspended screen.
   if (suspended_screen_) {
     // Clear screen, and put the cursor at the beginning of the drawing.
-    public_->ResetPosition(output_buffer, /*clear=*/true);
+    TerminalSend(public_->ResetPosition(/*clear=*/true));
     public_->dimx_ = 0;
     public_->dimy_ = 0;
     Uninstall();
@@ -900,6 +946,10 @@ void App::Internal::HandleTask(Component component, Task& task) {
         arg.mouse().y -= cursor_y_;
       }
 
+      if (recording_) {
+        recording_->Event(arg);
+      }
+
       arg.screen_ = public_;
 
       bool handled = component->OnEvent(arg);
@@ -914,8 +964,8 @@ void App::Internal::HandleTask(Component component, Task& task) {
         RecordSignal(SIGTSTP);
       }
 #endif
-      
-      frame_valid_ = false;
+
+      InvalidateFrame();
       return;
     }
 
@@ -938,7 +988,7 @@ void App::Internal::HandleTask(Component component, Task& task) {
 
       animation::Params params(delta);
       component->OnAnimation(params);
-      frame_valid_ = false;
+      InvalidateFrame();
       return;
     }
   },
@@ -998,14 +1048,46 @@ bool App::Internal::HandleSelection(bool handled, Event event) {
   return false;
 }
 
+// Request a new frame. A frame held back by AdaptToBandwidth is replaced by
+// it, and is never sent.
+void App::Internal::InvalidateFrame() {
+  if (frame_pending_) {
+    bandwidth_.stats().frames_dropped++;
+  }
+  frame_valid_ = false;
+}
+
 void App::Internal::Draw(Component component) {
   if (frame_valid_) {
     return;
   }
+
+  // While the terminal doesn't keep up, coalesce the frames: the next one is
+  // drawn once the previous one is expected to be through.
+  if (adapt_to_bandwidth_ && bandwidth_.congested()) {
+    const auto now = std::chrono::steady_clock::now();
+    if (now < bandwidth_.next_frame_time()) {
+      frame_pending_ = true;
+      if (!draw_scheduled_) {
+        draw_scheduled_ = true;
+        task_runner.PostDelayedTask([this] { draw_scheduled_ = false; },
+                                    bandwidth_.next_frame_time() - now);
+      }
+      return;
+    }
+  }
+
+  // The elements of the previous frame were released. Their memory is reused.
+  std::optional<FrameArena::Scope> arena_scope;
+  if (frame_arena_) {
+    frame_arena_->Reset();
+    arena_scope.emplace(*frame_arena_);
+  }
+
   auto document = component->Render();
   int dimx = 0;
   int dimy = 0;
-  auto terminal = Terminal::Size();
+  auto terminal = TerminalSize();
   document->ComputeRequirement();
   switch (dimension_) {
     case AppDimension::Fixed:
@@ -1026,6 +1108,11 @@ void App::Internal::Draw(Component component) {
       break;
   }
 
+  // Ask the terminal to display the frame only once it is fully received.
+  if (synchronized_output_) {
+    TerminalSend(Set({DECMode::kSynchronizedOutput}));
+  }
+
   // Hide cursor to prevent flickering during reset.
   TerminalSend("\033[?25l");
 
@@ -1036,7 +1123,7 @@ void App::Internal::Draw(Component component) {
   if (frame_count_ != 0) {
     // Reset the cursor position to the lower left corner to start drawing the
     // new frame.
-    public_->ResetPosition(output_buffer, resized);
+    TerminalSend(public_->ResetPosition(resized));
 
     // If the terminal width decrease, the terminal emulator will start wrapping
     // lines and make the display dirty. We should clear it completely.
@@ -1048,10 +1135,7 @@ void App::Internal::Draw(Component component) {
 
   // Resize the screen if needed.
   if (resized) {
-    public_->dimx_ = dimx;
-    public_->dimy_ = dimy;
-    public_->cells_ = std::vector<Cell>(static_cast<size_t>(dimx) *
-                                        static_cast<size_t>(dimy));
+    public_->Resize(dimx, dimy);
     Cursor cursor = public_->cursor_;
     cursor.x = dimx - 1;
     cursor.y = dimy - 1;
@@ -1072,6 +1156,21 @@ void App::Internal::Draw(Component component) {
                          selection_data_.start_x, selection_data_.start_y,  //
                          selection_data_.end_x, selection_data_.end_y);
   Render(*public_, document.get(), *selection_);
+  if (recording_) {
+    recording_->Frame(*public_);
+  }
+
+  // Reduce the size of the escape sequences, while the terminal doesn't keep
+  // up.
+  const bool downgrade_colors =
+      adapt_to_bandwidth_ && downgrade_colors_ && bandwidth_.congested();
+  bandwidth_.stats().colors_downgraded = downgrade_colors;
+  if (downgrade_colors) {
+    for (Cell& cell : public_->cells_) {
+      cell.foreground_color = cell.foreground_color.ToPalette256();
+      cell.background_color = cell.background_color.ToPalette256();
+    }
+  }
 
   // Set cursor position for user using tools to insert CJK characters.
   {
@@ -1099,13 +1198,47 @@ void App::Internal::Draw(Component component) {
     }
   }
 
-  public_->ToString(output_buffer);
+  if (resized) {
+    public_->ToString(output_);
+  } else {
+    // The terminal scrolling region can only be used when the screen covers
+    // the whole terminal, since it is expressed in terminal coordinates.
+    const bool scroll = dimx == terminal.dimx && dimy == terminal.dimy;
+    public_->ToString(output_, previous_frame_, scroll);
+  }
   TerminalSend(set_cursor_position_);
+  if (synchronized_output_) {
+    TerminalSend(Reset({DECMode::kSynchronizedOutput}));
+  }
   TerminalFlush();
 
+  // Double buffering: the frame sent becomes the previous one, and the
+  // buffer of the previous one is reused to draw the next frame.
+  // Both are tracking their damage, so clearing it only visits the cells drawn
+  // two frames ago.
+  public_->Swap(previous_frame_);
+  if (public_->dimx_ != dimx || public_->dimy_ != dimy) {
+    public_->Resize(dimx, dimy);
+  }
   public_->Clear();
   frame_valid_ = true;
+  frame_pending_ = false;
   frame_count_++;
+  bandwidth_.stats().frames++;
+}
+
+Dimensions App::Internal::TerminalSize() {
+#if defined(_WIN32)
+  // Resizing the console window isn't always notified. Query it every time.
+  return Terminal::Size();
+#else
+  // Querying the size is a system call. It is cached until the next SIGWINCH.
+  if (!terminal_size_valid_) {
+    terminal_size_ = Terminal::Size();
+    terminal_size_valid_ = true;
+  }
+  return terminal_size_;
+#endif
 }
 
 std::string App::Internal::ResetCursorPosition() {
@@ -1119,14 +1252,33 @@ void App::Internal::RequestCursorPosition(bool force) {
 }
 
 void App::Internal::TerminalSend(std::string_view s) {
-  output_buffer += s;
+  output_ += s;
 }
 
 void App::Internal::TerminalFlush() {
   // Emscripten doesn't implement flush. We interpret zero as flush.
-  output_buffer += '\0';
-  std::cout << output_buffer << std::flush;
-  output_buffer.clear();
+  output_ += '\0';
+  output_.Flush();
+
+  // The time spent blocked tells whether the terminal keeps up.
+  bandwidth_.OnWrite(output_.size() - output_flushed_, output_blocked_,
+                     std::chrono::steady_clock::now());
+  output_flushed_ = output_.size();
+  output_blocked_ = {};
+}
+
+void App::Internal::TerminalWrite(std::string_view data) {
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+  const auto start = std::chrono::steady_clock::now();
+  std::cout << data << std::flush;
+#else
+  // Bypass the iostream buffering and locking. Whatever was printed using
+  // std::cout must still be sent first.
+  std::cout.flush();
+  const auto start = std::chrono::steady_clock::now();
+  OutputSink(nullptr, 0, STDOUT_FILENO) += data;
+#endif
+  output_blocked_ += std::chrono::steady_clock::now() - start;
 }
 
 void App::Internal::InstallPipedInputHandling() {
@@ -1263,9 +1415,11 @@ void App::Internal::InstallTerminalInfo() {
     quirks.SetBlockCharacters(true);
     quirks.SetCursorHiding(true);
     quirks.SetComponentAscii(false);
+    quirks.SetSynchronizedOutput(true);
   }
 
   Terminal::SetQuirks(quirks);
+  synchronized_output_ = is_stdout_a_tty_ && quirks.SynchronizedOutput();
 
   on_exit_functions.emplace([this] {
     TerminalSend("\033[?25h");  // Enable cursor.
@@ -1286,7 +1440,7 @@ void App::Internal::Signal(int signal) {
   if (signal == SIGTSTP) {
     public_->Post([&] {
       TerminalSend(ResetCursorPosition());
-      public_->ResetPosition(output_buffer, /*clear*/ true);
+      TerminalSend(public_->ResetPosition(/*clear*/ true));
       Uninstall();
       public_->dimx_ = 0;
       public_->dimy_ = 0;
@@ -1297,6 +1451,7 @@ void App::Internal::Signal(int signal) {
   }
 
   if (signal == SIGWINCH) {
+    terminal_size_valid_ = false;
     public_->Post(Event::Special({0}));
     return;
   }
@@ -1429,6 +1584,9 @@ void App::Internal::PostAnimationTask() {
 App::App(std::unique_ptr<Internal> internal, int dimx, int dimy)
     : Screen(dimx, dimy), internal_(std::move(internal)) {
   internal_->public_ = this;
+  // The frames are drawn into blank screens. Recording the cells drawn makes
+  // clearing and diffing them proportional to what is drawn.
+  TrackDamage();
 }
 
 App::App(App&& other) noexcept : Screen(std::move(other)) {
@@ -1501,6 +1659,35 @@ void App::HandlePipedInput(bool enable) {
   internal_->handle_piped_input_ = enable;
 }
 
+void App::RecordTo(const std::string& path) {
+  internal_->recording_.reset();
+  internal_->recording_file_.reset();
+  if (path.empty()) {
+    return;
+  }
+  internal_->recording_file_ =
+      std::make_unique<std::ofstream>(path, std::ios::binary);
+  internal_->recording_ =
+      std::make_unique<RecordingWriter>(*internal_->recording_file_);
+}
+
+void App::AdaptToBandwidth(bool enable, bool downgrade_colors) {
+  internal_->adapt_to_bandwidth_ = enable;
+  internal_->downgrade_colors_ = downgrade_colors;
+}
+
+const App::OutputStats& App::GetOutputStats() const {
+  return internal_->bandwidth_.stats();
+}
+
+void App::UseFrameArena(bool enable) {
+  if (!enable) {
+    internal_->frame_arena_.reset();
+  } else if (!internal_->frame_arena_) {
+    internal_->frame_arena_ = std::make_unique<FrameArena>();
+  }
+}
+
 // static
 App* App::Active() {
   return g_active_screen;
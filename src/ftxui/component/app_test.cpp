@@ -11,7 +11,9 @@
 #include "ftxui/component/app.hpp"
 #include "ftxui/component/component.hpp"  // for Renderer
 #include "ftxui/component/loop.hpp"
+#include "ftxui/component/recording.hpp"  // for RecordingReader
 #include "ftxui/dom/elements.hpp"  // for text, Element
+#include "ftxui/screen/terminal.hpp"  // for SetFallbackSize
 
 #if defined(__unix__)
 #include <fcntl.h>
@@ -283,6 +285,273 @@ TEST(App, FixedSizeInitialFrame) {
 #endif
 }
 
+// After the first frame, only the cells that changed are sent.
+TEST(App, IncrementalFrame) {
+#if defined(__unix__)
+  std::string output;
+  {
+    auto screen = App::FixedSize(20, 2);
+    std::string content = "ABCD";
+    auto component = Renderer([&] { return text(content); });
+
+    Loop loop(&screen, component);
+    loop.RunOnce();
+
+    content = "ABXD";
+    screen.PostEvent(Event::Custom);
+    auto capture = StdCapture(&output);
+    loop.RunOnce();
+  }
+  using namespace std::string_literals;
+
+  std::string expected;
+  expected += "\x1B[?25l"s;   // Hide cursor.
+  expected += "\x1B[1C"s;     // Reset cursor position.
+  expected += "\r\x1B[1A"s;   // Move to the top-left corner.
+  expected += "\x1B[2C"s;     // Move to the modified cell.
+  expected += "X"s;           // Print it.
+  expected += "\x1B[1B"s;     // Move to the last line.
+  expected += "\r\x1B[20C"s;  // Move to the end of the last line.
+  expected += "\x1B[1D"s;     // Set cursor position.
+  expected += "\0"s;          // Flush stdout.
+  ASSERT_EQ(expected, output);
+#endif
+}
+
+// Every frame is compared against the one before it, not an older one.
+TEST(App, IncrementalFrameSequence) {
+#if defined(__unix__)
+  std::string output;
+  {
+    auto screen = App::FixedSize(20, 2);
+    std::string content = "ABCD";
+    auto component = Renderer([&] { return text(content); });
+
+    Loop loop(&screen, component);
+    loop.RunOnce();
+    content = "ABXD";
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+    content = "ABXY";
+    screen.PostEvent(Event::Custom);
+    auto capture = StdCapture(&output);
+    loop.RunOnce();
+  }
+  using namespace std::string_literals;
+
+  std::string expected;
+  expected += "\x1B[?25l"s;   // Hide cursor.
+  expected += "\x1B[1C"s;     // Reset cursor position.
+  expected += "\r\x1B[1A"s;   // Move to the top-left corner.
+  expected += "\x1B[3C"s;     // Move to the modified cell.
+  expected += "Y"s;           // Print it.
+  expected += "\x1B[1B"s;     // Move to the last line.
+  expected += "\r\x1B[20C"s;  // Move to the end of the last line.
+  expected += "\x1B[1D"s;     // Set cursor position.
+  expected += "\0"s;          // Flush stdout.
+  ASSERT_EQ(expected, output);
+#endif
+}
+
+// The frames drawn and the events received are recorded.
+TEST(App, RecordTo) {
+#if defined(__unix__)
+  const std::string path = ::testing::TempDir() + "ftxui_app_record_to";
+  std::string output;
+  {
+    auto capture = StdCapture(&output);
+    auto screen = App::FixedSize(20, 2);
+    screen.RecordTo(path);
+    std::string content = "ABCD";
+    auto component = Renderer([&] { return text(content); });
+
+    Loop loop(&screen, component);
+    loop.RunOnce();
+    content = "ABXD";
+    screen.PostEvent(Event::Character('x'));
+    loop.RunOnce();
+  }
+
+  RecordingReader reader(path);
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.type(), RecordingReader::Type::Frame);
+  EXPECT_EQ(reader.screen().dimx(), 20);
+  EXPECT_EQ(reader.screen().at(2, 0), "C");
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.type(), RecordingReader::Type::Event);
+  EXPECT_EQ(reader.event(), Event::Character('x'));
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.type(), RecordingReader::Type::Frame);
+  EXPECT_EQ(reader.screen().at(2, 0), "X");
+  EXPECT_FALSE(reader.Next());
+  EXPECT_TRUE(reader.ok());
+  std::remove(path.c_str());
+#endif
+}
+
+TEST(App, OutputStats) {
+#if defined(__unix__)
+  std::string output;
+  App::OutputStats stats;
+  {
+    auto capture = StdCapture(&output);
+    auto screen = App::FixedSize(20, 2);
+    screen.AdaptToBandwidth(true, true);
+    std::string content = "ABCD";
+    auto component = Renderer([&] { return text(content); });
+
+    Loop loop(&screen, component);
+    loop.RunOnce();
+    content = "ABXD";
+    screen.PostEvent(Event::Character('x'));
+    loop.RunOnce();
+    stats = screen.GetOutputStats();
+  }
+
+  EXPECT_EQ(stats.frames, 2u);
+  EXPECT_EQ(stats.frames_dropped, 0u);
+  EXPECT_GT(stats.bytes, 0u);
+  EXPECT_LE(stats.bytes, output.size());
+  EXPECT_FALSE(stats.congested);
+  EXPECT_FALSE(stats.colors_downgraded);
+#endif
+}
+
+// On a slow terminal, the frames are held back. A frame is only dropped when a
+// newer one replaces it before it is sent.
+TEST(App, OutputStatsFramesDropped) {
+#if defined(__unix__)
+  int pipefd[2];
+  ASSERT_EQ(pipe(pipefd), 0);
+  fflush(stdout);
+  const int old_stdout = dup(fileno(stdout));
+  dup2(pipefd[1], fileno(stdout));
+  close(pipefd[1]);
+
+  std::thread reader([&] {
+    std::array<char, 1024> buffer;
+    while (read(pipefd[0], buffer.data(), buffer.size()) > 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+
+  App::OutputStats stats;
+  {
+    auto screen = App::FixedSize(400, 400);
+    screen.AdaptToBandwidth(true, true);
+    auto component = Renderer([] { return text("A") | flex; });
+    Loop loop(&screen, component);
+
+    // The first frame blocks on the pipe. The output becomes congested.
+    loop.RunOnce();
+
+    // The next frame is held back, however many times it is requested.
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+    loop.RunOnce();
+    loop.RunOnce();
+    const App::OutputStats held = screen.GetOutputStats();
+
+    // A newer frame replaces it.
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+    stats = screen.GetOutputStats();
+
+    EXPECT_EQ(held.frames_dropped, 0u);
+  }
+
+  fflush(stdout);
+  dup2(old_stdout, fileno(stdout));
+  close(old_stdout);
+  reader.join();
+  close(pipefd[0]);
+
+  EXPECT_TRUE(stats.congested);
+  EXPECT_EQ(stats.frames, 1u);
+  EXPECT_EQ(stats.frames_dropped, 1u);
+#endif
+}
+
+// A frame larger than the pipe capacity is fully sent, even when stdout is
+// non-blocking.
+TEST(App, LargeFrameNonBlockingOutput) {
+#if defined(__unix__)
+  int pipefd[2];
+  ASSERT_EQ(pipe(pipefd), 0);
+  fcntl(pipefd[1], F_SETFL, fcntl(pipefd[1], F_GETFL) | O_NONBLOCK);
+  fflush(stdout);
+  const int old_stdout = dup(fileno(stdout));
+  dup2(pipefd[1], fileno(stdout));
+  close(pipefd[1]);
+
+  std::string output;
+  std::thread reader([&] {
+    std::array<char, 1024> buffer;
+    ssize_t count = 0;
+    while ((count = read(pipefd[0], buffer.data(), buffer.size())) > 0) {
+      output.append(buffer.data(), count);
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+    }
+  });
+
+  {
+    auto screen = App::FixedSize(400, 400);
+    auto component = Renderer([] { return text("A") | flex; });
+    Loop loop(&screen, component);
+    loop.RunOnce();
+  }
+
+  fflush(stdout);
+  dup2(old_stdout, fileno(stdout));
+  close(old_stdout);
+  reader.join();
+  close(pipefd[0]);
+
+  EXPECT_GT(output.size(), 400u * 400u);
+  EXPECT_NE(output.find("A"), std::string::npos);
+  // Every line is sent.
+  size_t lines = 0;
+  for (size_t i = output.find("\r\n"); i != std::string::npos;
+       i = output.find("\r\n", i + 1)) {
+    lines++;
+  }
+  EXPECT_GE(lines, 399u);
+#endif
+}
+
+// The terminal size is only queried again after a resize notification.
+TEST(App, TerminalSizeCachedUntilSIGWINCH) {
+#if defined(__unix__)
+  if (isatty(STDOUT_FILENO)) {
+    GTEST_SKIP() << "The terminal size doesn't come from the fallback.";
+  }
+  Terminal::SetFallbackSize({20, 5});
+  auto screen = App::FullscreenPrimaryScreen();
+  auto component = Renderer([] { return text(""); });
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(screen.dimx(), 20);
+  EXPECT_EQ(screen.dimy(), 5);
+
+  Terminal::SetFallbackSize({30, 6});
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(screen.dimx(), 20);
+  EXPECT_EQ(screen.dimy(), 5);
+
+  // Several signals are collapsed into a single relayout.
+  std::ignore = std::raise(SIGWINCH);
+  std::ignore = std::raise(SIGWINCH);
+  for (int i = 0; i < 10 && screen.dimx() != 30; ++i) {
+    loop.RunOnce();
+  }
+  EXPECT_EQ(screen.dimx(), 30);
+  EXPECT_EQ(screen.dimy(), 6);
+
+  Terminal::SetFallbackSize({80, 24});
+#endif
+}
+
 TEST(App, MoveConstructor) {
   auto screen = App::FixedSize(10, 10);
   App screen2 = std::move(screen);
@@ -0,0 +1,75 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/bandwidth_monitor.hpp"
+
+#include <algorithm>  // for max, min
+#include <chrono>  // for duration, duration_cast, microseconds, milliseconds, seconds
+
+namespace ftxui {
+
+namespace {
+
+// Shorter blocking times are ignored. They don't tell much about the
+// throughput.
+constexpr auto kMinBlocked = std::chrono::milliseconds(1);
+
+// The weight of the last write, in the moving averages.
+constexpr double kSmoothing = 0.25;
+
+// The output is congested when the smoothed fraction of the time spent blocked
+// exceeds kEnterPressure, and stays so until it falls below kExitPressure.
+constexpr double kEnterPressure = 0.2;
+constexpr double kExitPressure = 0.05;
+
+// Even on very slow links, send at least one frame per second.
+constexpr auto kMaxFrameInterval = std::chrono::seconds(1);
+
+}  // namespace
+
+void BandwidthMonitor::OnWrite(size_t bytes,
+                               Clock::duration blocked,
+                               Clock::time_point now) {
+  using Seconds = std::chrono::duration<double>;
+
+  stats_.bytes += bytes;
+  stats_.write_time +=
+      std::chrono::duration_cast<std::chrono::microseconds>(blocked);
+
+  // While blocked, the data was sent at the pace of the terminal.
+  if (blocked >= kMinBlocked) {
+    const double sample =
+        static_cast<double>(bytes) / Seconds(blocked).count();
+    stats_.throughput = stats_.throughput == 0.0
+                            ? sample
+                            : stats_.throughput +
+                                  kSmoothing * (sample - stats_.throughput);
+  }
+
+  // The fraction of the time spent blocked, since the previous write.
+  double ratio = 0.0;
+  if (blocked >= kMinBlocked) {
+    const Clock::duration elapsed =
+        started_ ? std::max(now - last_write_time_, blocked) : blocked;
+    ratio = Seconds(blocked).count() / Seconds(elapsed).count();
+  }
+  started_ = true;
+  last_write_time_ = now;
+  pressure_ += kSmoothing * (ratio - pressure_);
+
+  if (!stats_.congested && pressure_ > kEnterPressure) {
+    stats_.congested = true;
+  } else if (stats_.congested && pressure_ < kExitPressure) {
+    stats_.congested = false;
+  }
+
+  next_frame_time_ = now;
+  if (stats_.congested && stats_.throughput > 0.0) {
+    const Seconds drain(static_cast<double>(bytes) / stats_.throughput);
+    next_frame_time_ +=
+        std::min(std::chrono::duration_cast<Clock::duration>(drain),
+                 std::chrono::duration_cast<Clock::duration>(kMaxFrameInterval));
+  }
+}
+
+}  // namespace ftxui
@@ -0,0 +1,46 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_BANDWIDTH_MONITOR_HPP
+#define FTXUI_COMPONENT_BANDWIDTH_MONITOR_HPP
+
+#include <chrono>   // for steady_clock
+#include <cstddef>  // for size_t
+
+#include "ftxui/component/app.hpp"  // for App::OutputStats
+
+namespace ftxui {
+
+// Estimate whether the terminal keeps up with the output, from the time spent
+// blocked writing to it. A write blocks when the terminal, or the link to it,
+// doesn't consume the data as fast as it is produced.
+class BandwidthMonitor {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // Record |bytes| written, ending at |now|, after being blocked for
+  // |blocked|.
+  void OnWrite(size_t bytes, Clock::duration blocked, Clock::time_point now);
+
+  // Whether the output must be reduced.
+  bool congested() const { return stats_.congested; }
+
+  // While congested, the time at which the last write is expected to be
+  // through. The next frame shouldn't be sent before.
+  Clock::time_point next_frame_time() const { return next_frame_time_; }
+
+  App::OutputStats& stats() { return stats_; }
+  const App::OutputStats& stats() const { return stats_; }
+
+ private:
+  App::OutputStats stats_;
+  // The smoothed fraction of the time spent blocked writing.
+  double pressure_ = 0.0;
+  bool started_ = false;
+  Clock::time_point last_write_time_;
+  Clock::time_point next_frame_time_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_BANDWIDTH_MONITOR_HPP
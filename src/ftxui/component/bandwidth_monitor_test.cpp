@@ -0,0 +1,68 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/bandwidth_monitor.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>  // for milliseconds
+
+namespace ftxui {
+
+namespace {
+using std::chrono::milliseconds;
+using Clock = BandwidthMonitor::Clock;
+}  // namespace
+
+// Writes that don't block never congest the output.
+TEST(BandwidthMonitorTest, FastTerminal) {
+  BandwidthMonitor monitor;
+  Clock::time_point now;
+  for (int i = 0; i < 100; ++i) {
+    now += milliseconds(16);
+    monitor.OnWrite(10000, std::chrono::microseconds(50), now);
+  }
+  EXPECT_FALSE(monitor.congested());
+  EXPECT_EQ(monitor.stats().bytes, 1000000u);
+  EXPECT_EQ(monitor.stats().write_time.count(), 5000);
+  EXPECT_EQ(monitor.stats().throughput, 0.0);
+  EXPECT_EQ(monitor.next_frame_time(), now);
+}
+
+// A terminal receiving 100 KB/s, while frames of 10 KB are produced at 60 fps.
+TEST(BandwidthMonitorTest, SlowTerminal) {
+  BandwidthMonitor monitor;
+  Clock::time_point now;
+  for (int i = 0; i < 10; ++i) {
+    now += milliseconds(100);
+    monitor.OnWrite(10000, milliseconds(84), now);
+  }
+  EXPECT_TRUE(monitor.congested());
+  EXPECT_NEAR(monitor.stats().throughput, 10000 / 0.084, 1.0);
+
+  // The next frame is delayed until the previous one is expected to be sent.
+  EXPECT_GT(monitor.next_frame_time(), now + milliseconds(80));
+  EXPECT_LT(monitor.next_frame_time(), now + milliseconds(90));
+
+  // Once the frames are coalesced, the writes stop blocking. The output
+  // recovers.
+  for (int i = 0; i < 20; ++i) {
+    now += milliseconds(100);
+    monitor.OnWrite(10000, std::chrono::microseconds(100), now);
+  }
+  EXPECT_FALSE(monitor.congested());
+  EXPECT_EQ(monitor.next_frame_time(), now);
+}
+
+// The frames are delayed by at most one second.
+TEST(BandwidthMonitorTest, MaxFrameInterval) {
+  BandwidthMonitor monitor;
+  Clock::time_point now;
+  for (int i = 0; i < 5; ++i) {
+    now += milliseconds(3000);
+    monitor.OnWrite(1000000, milliseconds(2000), now);
+  }
+  EXPECT_TRUE(monitor.congested());
+  EXPECT_EQ(monitor.next_frame_time(), now + std::chrono::seconds(1));
+}
+
+}  // namespace ftxui
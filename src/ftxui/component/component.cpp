@@ -15,6 +15,7 @@
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Components
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/dom/elements.hpp"              // for text, Element
+#include "ftxui/dom/frame_arena.hpp"           // for MakeNode
 #include "ftxui/dom/node.hpp"                  // for Node, Elements
 #include "ftxui/screen/box.hpp"                // for Box
 
@@ -142,7 +143,7 @@ Element ComponentBase::Render() {
 
     void SetBox(Box box) override {
       Node::SetBox(box);
-      children_[0]->SetBox(box);
+      children_[0]->SetBoxIfNeeded(box);
     }
 
     void ComputeRequirement() override {
@@ -152,7 +153,7 @@ Element ComponentBase::Render() {
     }
   };
 
-  return std::make_shared<Wrapper>(std::move(element), Active(), Focused());
+  return MakeNode<Wrapper>(std::move(element), Active(), Focused());
 }
 
 /// @brief Draw the component.
@@ -0,0 +1,646 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/recording.hpp"
+
+#include <algorithm>    // for max
+#include <chrono>       // for duration_cast, microseconds, steady_clock
+#include <cstdint>      // for uint8_t, uint16_t, uint32_t, uint64_t
+#include <fstream>      // for ifstream
+#include <iterator>     // for istreambuf_iterator
+#include <limits>       // for numeric_limits
+#include <ostream>      // for ostream
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move, pair
+
+#include "ftxui/component/event.hpp"  // for Event
+#include "ftxui/component/mouse.hpp"  // for Mouse
+#include "ftxui/screen/cell.hpp"      // for Cell
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+#if !defined(_WIN32)
+#include <fcntl.h>     // for open, O_RDONLY
+#include <sys/mman.h>  // for mmap, munmap
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+#endif
+
+// The format of a recording:
+//
+//   "FTXUI-REC" version:u8 record*
+//
+// Every record starts with its type, and the time elapsed since the previous
+// record, in microseconds:
+//
+//   frame: 'F' time:varint dimx:varint dimy:varint
+//              cursor_x:varint cursor_y:varint cursor_shape:u8
+//              (skip:varint length:varint cell[length])* 0:varint 0:varint
+//   event: 'E' time:varint kind:u8 input:string [mouse]
+//
+// A frame lists the runs of cells modified since the previous frame. Each run
+// starts |skip| cells after the end of the previous one. When the dimensions
+// change, every cell is listed.
+//
+//   cell:  same:u8 [glyph:string] [style:u16] [foreground:color]
+//          [background:color] [hyperlink:varint [link:string]]
+//
+// The |same| bitfield lists the attributes identical to the previous cell of
+// the frame, which are omitted. A hyperlink is identified by its id in the
+// recording. Its content follows its first use.
+//
+//   color: type:u8 red:u8 green:u8 blue:u8 alpha:u8
+//   mouse: button:u8 motion:u8 modifiers:u8 x:zigzag y:zigzag
+//   string: size:varint bytes[size]
+
+namespace ftxui {
+
+namespace {
+
+constexpr std::string_view kMagic = "FTXUI-REC";
+constexpr uint8_t kVersion = 1;
+
+constexpr char kFrame = 'F';
+
+// The largest frames accepted when reading.
+constexpr uint64_t kMaxDimension = 1 << 16;
+constexpr uint64_t kMaxCells = 1 << 24;
+constexpr char kEvent = 'E';
+
+enum EventKind : uint8_t {
+  kSpecial = 0,
+  kCharacter = 1,
+  kMouse = 2,
+};
+
+enum Same : uint8_t {
+  kSameStyle = 1 << 0,
+  kSameForeground = 1 << 1,
+  kSameBackground = 1 << 2,
+  kSameHyperlink = 1 << 3,
+  kSameGlyph = 1 << 4,
+};
+
+void WriteVarint(std::string& out, uint64_t value) {
+  while (value >= 0x80) {
+    out += static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  out += static_cast<char>(value);
+}
+
+void WriteZigzag(std::string& out, int value) {
+  const auto v = static_cast<int64_t>(value);
+  WriteVarint(out, static_cast<uint64_t>((v << 1) ^ (v >> 63)));
+}
+
+void WriteString(std::string& out, std::string_view str) {
+  WriteVarint(out, str.size());
+  out += str;
+}
+
+uint16_t PackStyle(const Cell& cell) {
+  return static_cast<uint16_t>(cell.blink << 0 |              //
+                               cell.bold << 1 |               //
+                               cell.dim << 2 |                //
+                               cell.italic << 3 |             //
+                               cell.inverted << 4 |           //
+                               cell.underlined << 5 |         //
+                               cell.underlined_double << 6 |  //
+                               cell.strikethrough << 7 |      //
+                               cell.automerge << 8);
+}
+
+void UnpackStyle(Cell& cell, uint16_t style) {
+  cell.blink = (style >> 0) & 1;
+  cell.bold = (style >> 1) & 1;
+  cell.dim = (style >> 2) & 1;
+  cell.italic = (style >> 3) & 1;
+  cell.inverted = (style >> 4) & 1;
+  cell.underlined = (style >> 5) & 1;
+  cell.underlined_double = (style >> 6) & 1;
+  cell.strikethrough = (style >> 7) & 1;
+  cell.automerge = (style >> 8) & 1;
+}
+
+bool SameCell(const Cell& a, const Cell& b) {
+  return a.character == b.character &&                //
+         a.foreground_color == b.foreground_color &&  //
+         a.background_color == b.background_color &&  //
+         a.hyperlink == b.hyperlink &&                //
+         PackStyle(a) == PackStyle(b);
+}
+
+// Read primitives. They return false when the data is truncated.
+bool ReadByte(const char*& position, const char* end, uint8_t& out) {
+  if (position >= end) {
+    return false;
+  }
+  out = static_cast<uint8_t>(*position++);
+  return true;
+}
+
+bool ReadVarint(const char*& position, const char* end, uint64_t& out) {
+  out = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    uint8_t byte = 0;
+    if (!ReadByte(position, end, byte)) {
+      return false;
+    }
+    out |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ReadZigzag(const char*& position, const char* end, int& out) {
+  uint64_t value = 0;
+  if (!ReadVarint(position, end, value)) {
+    return false;
+  }
+  out = static_cast<int>(static_cast<int64_t>(value >> 1) ^
+                         -static_cast<int64_t>(value & 1));
+  return true;
+}
+
+bool ReadString(const char*& position,
+                const char* end,
+                std::string_view& out) {
+  uint64_t size = 0;
+  if (!ReadVarint(position, end, size) ||
+      size > static_cast<uint64_t>(end - position)) {
+    return false;
+  }
+  out = std::string_view(position, size);
+  position += size;
+  return true;
+}
+
+}  // namespace
+
+// Colors are stored field by field, independently of the memory layout of
+// Color. Unknown types are rejected, so a corrupt recording can't produce an
+// invalid Color.
+struct ColorCodec {
+  static void Write(std::string& out, const Color& color) {
+    out += static_cast<char>(color.type_);
+    out += static_cast<char>(color.red_);
+    out += static_cast<char>(color.green_);
+    out += static_cast<char>(color.blue_);
+    out += static_cast<char>(color.alpha_);
+  }
+
+  static bool Read(const char*& position, const char* end, Color& color) {
+    uint8_t type = 0;
+    if (!ReadByte(position, end, type) ||
+        type > static_cast<uint8_t>(Color::ColorType::TrueColor)) {
+      return false;
+    }
+    color.type_ = static_cast<Color::ColorType>(type);
+    return ReadByte(position, end, color.red_) &&
+           ReadByte(position, end, color.green_) &&
+           ReadByte(position, end, color.blue_) &&
+           ReadByte(position, end, color.alpha_);
+  }
+};
+
+RecordingWriter::RecordingWriter(std::ostream& out)
+    : out_(out), start_(std::chrono::steady_clock::now()) {
+  buffer_ += kMagic;
+  buffer_ += static_cast<char>(kVersion);
+  End();
+}
+
+/// @brief Record a frame. Only the cells modified since the previous frame are
+/// stored.
+/// @param screen The frame drawn.
+void RecordingWriter::Frame(const Screen& screen) {
+  Begin(kFrame);
+  WriteVarint(buffer_, static_cast<uint64_t>(screen.dimx()));
+  WriteVarint(buffer_, static_cast<uint64_t>(screen.dimy()));
+  const Screen::Cursor cursor = screen.cursor();
+  WriteVarint(buffer_, static_cast<uint64_t>(std::max(cursor.x, 0)));
+  WriteVarint(buffer_, static_cast<uint64_t>(std::max(cursor.y, 0)));
+  buffer_ += static_cast<char>(cursor.shape);
+
+  // Update the copy of the frame, and collect the runs of modified cells.
+  const bool resized = screen.dimx() != dimx_ || screen.dimy() != dimy_;
+  dimx_ = screen.dimx();
+  dimy_ = screen.dimy();
+  const size_t size =
+      static_cast<size_t>(dimx_) * static_cast<size_t>(dimy_);
+  cells_.resize(size);
+  links_.resize(size);
+  runs_.clear();
+  size_t index = 0;
+  for (int y = 0; y < dimy_; ++y) {
+    for (int x = 0; x < dimx_; ++x, ++index) {
+      Cell cell = screen.CellAt(x, y);
+      uint32_t link = 0;
+      if (cell.hyperlink != 0) {
+        link = HyperlinkId(screen.Hyperlink(cell.hyperlink));
+        cell.hyperlink = 0;
+      }
+      if (!resized && link == links_[index] && SameCell(cell, cells_[index])) {
+        continue;
+      }
+      cells_[index] = cell;
+      links_[index] = link;
+      if (!runs_.empty() && runs_.back().second == index) {
+        runs_.back().second++;
+      } else {
+        runs_.emplace_back(index, index + 1);
+      }
+    }
+  }
+
+  size_t end = 0;
+  Cell previous;
+  uint32_t previous_link = 0;
+  for (const auto& [run_begin, run_end] : runs_) {
+    WriteVarint(buffer_, run_begin - end);
+    WriteVarint(buffer_, run_end - run_begin);
+    for (size_t i = run_begin; i < run_end; ++i) {
+      WriteCell(cells_[i], links_[i], previous, previous_link);
+    }
+    end = run_end;
+  }
+  WriteVarint(buffer_, 0);
+  WriteVarint(buffer_, 0);
+  End();
+}
+
+/// @brief Record an event.
+/// @param event The event received.
+void RecordingWriter::Event(const ftxui::Event& event) {
+  Begin(kEvent);
+  ftxui::Event copy = event;
+  if (copy.is_mouse()) {
+    const Mouse& mouse = copy.mouse();
+    buffer_ += static_cast<char>(kMouse);
+    WriteString(buffer_, copy.input());
+    buffer_ += static_cast<char>(mouse.button);
+    buffer_ += static_cast<char>(mouse.motion);
+    buffer_ += static_cast<char>(mouse.shift << 0 |  //
+                                 mouse.meta << 1 |   //
+                                 mouse.control << 2);
+    WriteZigzag(buffer_, mouse.x);
+    WriteZigzag(buffer_, mouse.y);
+  } else {
+    buffer_ += static_cast<char>(copy.is_character() ? kCharacter : kSpecial);
+    WriteString(buffer_, copy.input());
+  }
+  End();
+}
+
+void RecordingWriter::Begin(char type) {
+  const auto now = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start_);
+  buffer_ += type;
+  WriteVarint(buffer_, static_cast<uint64_t>((now - time_).count()));
+  time_ = now;
+}
+
+void RecordingWriter::End() {
+  out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  size_ += buffer_.size();
+  buffer_.clear();
+}
+
+void RecordingWriter::WriteCell(const Cell& cell,
+                                uint32_t link,
+                                Cell& previous,
+                                uint32_t& previous_link) {
+  const uint16_t style = PackStyle(cell);
+  uint8_t same = 0;
+  if (style == PackStyle(previous)) {
+    same |= kSameStyle;
+  }
+  if (cell.foreground_color == previous.foreground_color) {
+    same |= kSameForeground;
+  }
+  if (cell.background_color == previous.background_color) {
+    same |= kSameBackground;
+  }
+  if (link == previous_link) {
+    same |= kSameHyperlink;
+  }
+  if (cell.character == previous.character) {
+    same |= kSameGlyph;
+  }
+
+  buffer_ += static_cast<char>(same);
+  if (!(same & kSameGlyph)) {
+    WriteString(buffer_, cell.character.str());
+  }
+  if (!(same & kSameStyle)) {
+    buffer_ += static_cast<char>(style & 0xFF);
+    buffer_ += static_cast<char>(style >> 8);
+  }
+  if (!(same & kSameForeground)) {
+    ColorCodec::Write(buffer_, cell.foreground_color);
+  }
+  if (!(same & kSameBackground)) {
+    ColorCodec::Write(buffer_, cell.background_color);
+  }
+  if (!(same & kSameHyperlink)) {
+    WriteVarint(buffer_, link);
+    // Hyperlinks are numbered in order of first use.
+    if (link > hyperlinks_written_) {
+      WriteString(buffer_, hyperlinks_[link - 1]);
+      hyperlinks_written_ = link;
+    }
+  }
+  previous = cell;
+  previous_link = link;
+}
+
+uint32_t RecordingWriter::HyperlinkId(const std::string& link) {
+  auto it = hyperlinks_index_.find(link);
+  if (it != hyperlinks_index_.end()) {
+    return it->second;
+  }
+  hyperlinks_.push_back(link);
+  const auto id = static_cast<uint32_t>(hyperlinks_.size());
+  hyperlinks_index_.emplace(link, id);
+  return id;
+}
+
+RecordingReader::RecordingReader(const std::string& path) {
+#if !defined(_WIN32)
+  const int fd = ::open(path.c_str(), O_RDONLY);  // NOLINT
+  if (fd >= 0) {
+    struct stat info = {};
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+      void* mapping = ::mmap(nullptr, static_cast<size_t>(info.st_size),
+                             PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED) {  // NOLINT
+        mapping_ = mapping;
+        mapping_size_ = static_cast<size_t>(info.st_size);
+      }
+    }
+    ::close(fd);
+  }
+  if (mapping_) {
+    Open(std::string_view(static_cast<const char*>(mapping_), mapping_size_));
+    return;
+  }
+#endif
+
+  // Fallback: read the whole file.
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return;
+  }
+  content_.assign(std::istreambuf_iterator<char>(file),
+                  std::istreambuf_iterator<char>());
+  Open(content_);
+}
+
+RecordingReader::RecordingReader(const char* data, size_t size) {
+  Open(std::string_view(data, size));
+}
+
+RecordingReader::~RecordingReader() {
+#if !defined(_WIN32)
+  if (mapping_) {
+    ::munmap(mapping_, mapping_size_);
+  }
+#endif
+}
+
+bool RecordingReader::Open(std::string_view data) {
+  data_ = data.data();
+  end_ = data.data() + data.size();
+  position_ = data_;
+  if (data.size() < kMagic.size() + 1 ||
+      data.substr(0, kMagic.size()) != kMagic ||
+      static_cast<uint8_t>(data[kMagic.size()]) != kVersion) {
+    return ok_ = false;
+  }
+  position_ += kMagic.size() + 1;
+  return ok_ = true;
+}
+
+/// @brief Read the next record.
+/// @return false at the end of the recording, or if it is invalid.
+bool RecordingReader::Next() {
+  if (!ok_ || position_ >= end_) {
+    return false;
+  }
+  const char* begin = position_;
+  uint8_t type = 0;
+  uint64_t delta = 0;
+  if (!ReadByte(position_, end_, type) ||
+      !ReadVarint(position_, end_, delta)) {
+    return ok_ = false;
+  }
+  time_ += std::chrono::microseconds(delta);
+
+  switch (static_cast<char>(type)) {
+    case kFrame:
+      type_ = Type::Frame;
+      ok_ = ReadFrame();
+      break;
+    case kEvent:
+      type_ = Type::Event;
+      ok_ = ReadEvent();
+      break;
+    default:
+      ok_ = false;
+      break;
+  }
+  record_size_ = static_cast<size_t>(position_ - begin);
+  return ok_;
+}
+
+bool RecordingReader::ReadFrame() {
+  uint64_t dimx = 0;
+  uint64_t dimy = 0;
+  uint64_t cursor_x = 0;
+  uint64_t cursor_y = 0;
+  uint8_t cursor_shape = 0;
+  if (!ReadVarint(position_, end_, dimx) ||
+      !ReadVarint(position_, end_, dimy) ||
+      !ReadVarint(position_, end_, cursor_x) ||
+      !ReadVarint(position_, end_, cursor_y) ||
+      !ReadByte(position_, end_, cursor_shape)) {
+    return false;
+  }
+  // A resized frame lists every cell, using at least one byte each. This
+  // bounds the memory allocated for a corrupt recording.
+  const uint64_t size = dimx * dimy;
+  if (dimx > kMaxDimension || dimy > kMaxDimension || size > kMaxCells) {
+    return false;
+  }
+
+  if (static_cast<int>(dimx) != screen_.dimx() ||
+      static_cast<int>(dimy) != screen_.dimy()) {
+    if (size > static_cast<uint64_t>(end_ - position_)) {
+      return false;
+    }
+    screen_ = Screen(static_cast<int>(dimx), static_cast<int>(dimy));
+    links_.assign(size, 0);
+  }
+  screen_.SetCursor(Screen::Cursor{
+      static_cast<int>(cursor_x),
+      static_cast<int>(cursor_y),
+      static_cast<Screen::Cursor::Shape>(cursor_shape),
+  });
+
+  uint64_t index = 0;
+  Cell previous;
+  uint32_t previous_link = 0;
+  bool relinked = false;
+  while (true) {
+    uint64_t skip = 0;
+    uint64_t length = 0;
+    if (!ReadVarint(position_, end_, skip) ||
+        !ReadVarint(position_, end_, length)) {
+      return false;
+    }
+    if (length == 0) {
+      return true;
+    }
+    index += skip;
+    if (index + length > size) {
+      return false;
+    }
+    for (uint64_t i = 0; i < length; ++i, ++index) {
+      const int x = static_cast<int>(index % dimx);
+      const int y = static_cast<int>(index / dimx);
+      Cell& cell = screen_.CellAt(x, y);
+      if (!ReadCell(cell, links_[index], previous, previous_link)) {
+        return false;
+      }
+      // The hyperlinks of |screen_| are full. Start over from the ones
+      // displayed.
+      if (cell.hyperlink == 0 && links_[index] != 0 && !relinked) {
+        RegisterHyperlinks();
+        relinked = true;
+      }
+    }
+  }
+}
+
+bool RecordingReader::ReadCell(Cell& cell,
+                               uint32_t& link,
+                               Cell& previous,
+                               uint32_t& previous_link) {
+  uint8_t same = 0;
+  if (!ReadByte(position_, end_, same)) {
+    return false;
+  }
+  cell = previous;
+  if (!(same & kSameGlyph)) {
+    std::string_view glyph;
+    if (!ReadString(position_, end_, glyph)) {
+      return false;
+    }
+    cell.character = glyph;
+  }
+
+  if (!(same & kSameStyle)) {
+    uint8_t low = 0;
+    uint8_t high = 0;
+    if (!ReadByte(position_, end_, low) || !ReadByte(position_, end_, high)) {
+      return false;
+    }
+    UnpackStyle(cell, static_cast<uint16_t>(low | high << 8));
+  }
+  if (!(same & kSameForeground) &&
+      !ColorCodec::Read(position_, end_, cell.foreground_color)) {
+    return false;
+  }
+  if (!(same & kSameBackground) &&
+      !ColorCodec::Read(position_, end_, cell.background_color)) {
+    return false;
+  }
+  previous = cell;
+
+  // |link| is the id in the recording, while |cell| refers to the hyperlinks
+  // registered in |screen_|.
+  if (!(same & kSameHyperlink)) {
+    uint64_t id = 0;
+    if (!ReadVarint(position_, end_, id) || id > hyperlinks_.size() + 1 ||
+        id > std::numeric_limits<uint32_t>::max()) {
+      return false;
+    }
+    if (id == hyperlinks_.size() + 1) {
+      std::string_view content;
+      if (!ReadString(position_, end_, content)) {
+        return false;
+      }
+      hyperlinks_.emplace_back(content);
+    }
+    previous_link = static_cast<uint32_t>(id);
+  }
+  link = previous_link;
+  cell.hyperlink =
+      link == 0 ? 0 : screen_.RegisterHyperlink(hyperlinks_[link - 1]);
+  return true;
+}
+
+// Register again the hyperlinks of the cells into a new screen. The ones
+// registered into |screen_| accumulate from one frame to the next, up to the
+// limit of the screen.
+void RecordingReader::RegisterHyperlinks() {
+  Screen screen(screen_.dimx(), screen_.dimy());
+  screen.SetCursor(screen_.cursor());
+  size_t index = 0;
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x, ++index) {
+      Cell& cell = screen.CellAt(x, y);
+      cell = screen_.CellAt(x, y);
+      cell.hyperlink =
+          links_[index] == 0
+              ? 0
+              : screen.RegisterHyperlink(hyperlinks_[links_[index] - 1]);
+    }
+  }
+  screen_ = std::move(screen);
+}
+
+bool RecordingReader::ReadEvent() {
+  uint8_t kind = 0;
+  std::string_view input;
+  if (!ReadByte(position_, end_, kind) ||
+      !ReadString(position_, end_, input)) {
+    return false;
+  }
+  switch (kind) {
+    case kSpecial:
+      event_ = ftxui::Event::Special(input);
+      return true;
+    case kCharacter:
+      event_ = ftxui::Event::Character(input);
+      return true;
+    case kMouse: {
+      uint8_t button = 0;
+      uint8_t motion = 0;
+      uint8_t modifiers = 0;
+      Mouse mouse;
+      if (!ReadByte(position_, end_, button) ||
+          !ReadByte(position_, end_, motion) ||
+          !ReadByte(position_, end_, modifiers) ||
+          !ReadZigzag(position_, end_, mouse.x) ||
+          !ReadZigzag(position_, end_, mouse.y)) {
+        return false;
+      }
+      mouse.button = static_cast<Mouse::Button>(button);
+      mouse.motion = static_cast<Mouse::Motion>(motion);
+      mouse.shift = (modifiers >> 0) & 1;
+      mouse.meta = (modifiers >> 1) & 1;
+      mouse.control = (modifiers >> 2) & 1;
+      event_ = ftxui::Event::Mouse(input, mouse);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+}  // namespace ftxui
@@ -0,0 +1,225 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/recording.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>   // for remove
+#include <fstream>  // for ofstream
+#include <iterator> // for size
+#include <sstream>  // for stringstream
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ftxui/component/event.hpp"  // for Event
+#include "ftxui/component/mouse.hpp"  // for Mouse
+#include "ftxui/dom/elements.hpp"     // for text, bgcolor, hyperlink
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/terminal.hpp"  // for SetColorSupport, Color, TrueColor
+
+namespace ftxui {
+
+namespace {
+
+Screen Draw(int dimx, int dimy, Element element) {
+  Screen screen(dimx, dimy);
+  Render(screen, element);
+  return screen;
+}
+
+}  // namespace
+
+TEST(RecordingTest, Empty) {
+  std::stringstream stream;
+  RecordingWriter writer(stream);
+  const std::string data = stream.str();
+  EXPECT_EQ(writer.size(), data.size());
+
+  RecordingReader reader(data.data(), data.size());
+  EXPECT_TRUE(reader.ok());
+  EXPECT_FALSE(reader.Next());
+  EXPECT_TRUE(reader.ok());
+}
+
+TEST(RecordingTest, Invalid) {
+  const std::string data = "not a recording";
+  RecordingReader reader(data.data(), data.size());
+  EXPECT_FALSE(reader.ok());
+  EXPECT_FALSE(reader.Next());
+
+  RecordingReader missing("/nonexistent/recording");
+  EXPECT_FALSE(missing.ok());
+}
+
+TEST(RecordingTest, Truncated) {
+  std::stringstream stream;
+  RecordingWriter writer(stream);
+  writer.Frame(Draw(10, 2, text("Hello")));
+  std::string data = stream.str();
+  data.resize(data.size() - 3);
+
+  RecordingReader reader(data.data(), data.size());
+  EXPECT_FALSE(reader.Next());
+  EXPECT_FALSE(reader.ok());
+}
+
+// A frame whose dimensions exceed what the rest of the file can hold is
+// rejected, without allocating it.
+TEST(RecordingTest, HugeFrame) {
+  std::stringstream stream;
+  RecordingWriter writer(stream);
+  std::string data = stream.str();
+  // 'F' time:0 dimx:65536 dimy:65536 cursor_x:0 cursor_y:0 cursor_shape:0
+  // followed by the end of the runs.
+  data += std::string("F\x00\x80\x80\x04\x80\x80\x04\x00\x00\x00\x00\x00", 13);
+
+  RecordingReader reader(data.data(), data.size());
+  EXPECT_FALSE(reader.Next());
+  EXPECT_FALSE(reader.ok());
+}
+
+// The ids of the hyperlinks aren't limited by the ones of the screen.
+TEST(RecordingTest, ManyHyperlinks) {
+  const int count = 70000;
+  auto link = [](int i) { return "https://" + std::to_string(i) + ".com"; };
+
+  std::stringstream stream;
+  RecordingWriter writer(stream);
+  for (int i = 0; i < count; ++i) {
+    Screen screen(2, 1);
+    screen.CellAt(0, 0).hyperlink = screen.RegisterHyperlink(link(i));
+    screen.CellAt(1, 0).hyperlink = screen.RegisterHyperlink(link(i % 10));
+    writer.Frame(screen);
+  }
+  const std::string data = stream.str();
+
+  RecordingReader reader(data.data(), data.size());
+  for (int i = 0; i < count; ++i) {
+    ASSERT_TRUE(reader.Next());
+    const Screen& screen = reader.screen();
+    ASSERT_EQ(screen.Hyperlink(screen.CellAt(0, 0).hyperlink), link(i));
+    ASSERT_EQ(screen.Hyperlink(screen.CellAt(1, 0).hyperlink), link(i % 10));
+  }
+  EXPECT_FALSE(reader.Next());
+  EXPECT_TRUE(reader.ok());
+}
+
+TEST(RecordingTest, InvalidColor) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  std::stringstream stream;
+  RecordingWriter writer(stream);
+  writer.Frame(Draw(1, 1, text("a") | bgcolor(Color::RGB(1, 2, 3))));
+  std::string data = stream.str();
+
+  // The frame ends with the background color of its only cell, followed by
+  // the end of the runs: type:u8 red:u8 green:u8 blue:u8 alpha:u8 0 0.
+  ASSERT_GE(data.size(), 7u);
+  const size_t type = data.size() - 7;
+  EXPECT_EQ(data.substr(type + 1, 3), "\x01\x02\x03");
+
+  data[type] = 0x7F;
+  RecordingReader reader(data.data(), data.size());
+  EXPECT_FALSE(reader.Next());
+  EXPECT_FALSE(reader.ok());
+}
+
+TEST(RecordingTest, Frames) {
+  const Screen frames[] = {
+      Draw(10, 2, text("Hello") | color(Color::Red)),
+      Draw(10, 2, text("Hello") | color(Color::Red)),
+      Draw(10, 2, text("Help!") | color(Color::Red)),
+      Draw(10, 2, text("Help!") | bold | bgcolor(Color::RGB(1, 2, 3))),
+      Draw(12, 3, vbox({text("ab"), text("e\u0301\u0302测") | underlined})),
+      Draw(12, 3, hyperlink("https://a.com", text("link"))),
+      Draw(12, 3, hbox({hyperlink("https://b.com", text("bb")),
+                        hyperlink("https://a.com", text("aa"))})),
+  };
+
+  std::stringstream stream;
+  RecordingWriter writer(stream);
+  std::vector<size_t> sizes;
+  for (const auto& frame : frames) {
+    const size_t before = writer.size();
+    writer.Frame(frame);
+    sizes.push_back(writer.size() - before);
+  }
+  const std::string data = stream.str();
+
+  // Only the modified cells are stored.
+  EXPECT_LT(sizes[1], 16u);
+  EXPECT_LT(sizes[2], 32u);
+
+  RecordingReader reader(data.data(), data.size());
+  for (size_t i = 0; i < std::size(frames); ++i) {
+    ASSERT_TRUE(reader.Next());
+    EXPECT_EQ(reader.type(), RecordingReader::Type::Frame);
+    EXPECT_EQ(reader.record_size(), sizes[i]);
+    EXPECT_EQ(reader.screen().ToString(), frames[i].ToString());
+    EXPECT_EQ(reader.screen().cursor().x, frames[i].cursor().x);
+    EXPECT_EQ(reader.screen().cursor().y, frames[i].cursor().y);
+  }
+  EXPECT_FALSE(reader.Next());
+  EXPECT_TRUE(reader.ok());
+}
+
+TEST(RecordingTest, Events) {
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = Mouse::Pressed;
+  mouse.control = true;
+  mouse.x = 3;
+  mouse.y = -1;
+
+  std::stringstream stream;
+  RecordingWriter writer(stream);
+  writer.Event(Event::Character("a"));
+  writer.Event(Event::ArrowUp);
+  writer.Frame(Draw(4, 1, text("a")));
+  writer.Event(Event::Mouse("\x1B[<0;4;0M", mouse));
+  const std::string data = stream.str();
+
+  RecordingReader reader(data.data(), data.size());
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.type(), RecordingReader::Type::Event);
+  EXPECT_EQ(reader.event(), Event::Character("a"));
+  EXPECT_TRUE(reader.event().is_character());
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.event(), Event::ArrowUp);
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.type(), RecordingReader::Type::Frame);
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.type(), RecordingReader::Type::Event);
+  Event event = reader.event();
+  ASSERT_TRUE(event.is_mouse());
+  EXPECT_EQ(event.mouse().button, Mouse::Left);
+  EXPECT_EQ(event.mouse().motion, Mouse::Pressed);
+  EXPECT_TRUE(event.mouse().control);
+  EXPECT_FALSE(event.mouse().shift);
+  EXPECT_EQ(event.mouse().x, 3);
+  EXPECT_EQ(event.mouse().y, -1);
+  EXPECT_FALSE(reader.Next());
+
+  // Timestamps are increasing.
+  EXPECT_GE(reader.time().count(), 0);
+}
+
+TEST(RecordingTest, File) {
+  const std::string path = ::testing::TempDir() + "ftxui_recording_test";
+  const Screen frame = Draw(10, 2, text("Hello"));
+  {
+    std::ofstream file(path, std::ios::binary);
+    RecordingWriter writer(file);
+    writer.Frame(frame);
+  }
+  {
+    RecordingReader reader(path);
+    EXPECT_TRUE(reader.ok());
+    ASSERT_TRUE(reader.Next());
+    EXPECT_EQ(reader.screen().ToString(), frame.ToString());
+    EXPECT_FALSE(reader.Next());
+  }
+  std::remove(path.c_str());
+}
+
+}  // namespace ftxui
@@ -8,8 +8,11 @@ module;
 #include <ftxui/dom/direction.hpp>
 #include <ftxui/dom/elements.hpp>
 #include <ftxui/dom/flexbox_config.hpp>
+#include <ftxui/dom/frame_arena.hpp>
 #include <ftxui/dom/linear_gradient.hpp>
+#include <ftxui/dom/memo.hpp>
 #include <ftxui/dom/node.hpp>
+#include <ftxui/dom/paragraph_config.hpp>
 #include <ftxui/dom/requirement.hpp>
 #include <ftxui/dom/selection.hpp>
 #include <ftxui/dom/table.hpp>
@@ -29,6 +32,7 @@ export namespace ftxui {
     using ftxui::Element;
     using ftxui::Elements;
     using ftxui::FlexboxConfig;
+    using ftxui::ParagraphConfig;
     using ftxui::GraphFunction;
     using ftxui::LinearGradient;
     using ftxui::Node;
@@ -43,6 +47,7 @@ export namespace ftxui {
     using ftxui::operator|=;
 
     using ftxui::GetNodeSelectedContent;
+    using ftxui::LayoutNode;
     using ftxui::Render;
 
     using ftxui::text;
@@ -142,6 +147,12 @@ export namespace ftxui {
     using ftxui::hscroll_indicator;
     using ftxui::reflect;
     using ftxui::clear_under;
+    using ftxui::Memo;
+    using ftxui::memo;
+    using ftxui::virtualList;
+    using ftxui::FrameArena;
+    using ftxui::FrameArenaAllocator;
+    using ftxui::MakeNode;
 
     using ftxui::hcenter;
     using ftxui::vcenter;
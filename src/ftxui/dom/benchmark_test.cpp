@@ -2,9 +2,13 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <benchmark/benchmark.h>
+#include <optional>  // for optional
+#include <string>    // for to_string
 
 #include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
+#include "ftxui/dom/frame_arena.hpp"  // for FrameArena
 #include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/table.hpp"     // for Table
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 // NOLINTBEGIN
@@ -48,6 +52,34 @@ static void BencharkText(benchmark::State& state) {
 }
 BENCHMARK(BencharkText)->DenseRange(0, 10, 1);
 
+// Build and render a single text of many lines. The argument selects whether
+// it contains non-ASCII characters.
+static void BenchmarkLongText(benchmark::State& state) {
+  std::string content;
+  for (int i = 0; i < 1000; ++i) {
+    content += state.range(0) ? "Ｌine " : "Line ";
+    content += std::to_string(i) + ": The quick brown fox jumps over it.\n";
+  }
+  Screen screen(80, 60);
+  for (auto _ : state) {
+    Render(screen, text(content));
+  }
+}
+BENCHMARK(BenchmarkLongText)->Arg(0)->Arg(1);
+
+// Build and lay out a long help text, wrapped into a paragraph.
+static void BenchmarkParagraph(benchmark::State& state) {
+  std::string content;
+  while (content.size() < size_t(state.range(0))) {
+    content += "The quick brown fox jumps over the lazy dog. ";
+  }
+  Screen screen(80, 60);
+  for (auto _ : state) {
+    Render(screen, paragraph(content));
+  }
+}
+BENCHMARK(BenchmarkParagraph)->Arg(1000)->Arg(50000);
+
 static void BenchmarkStyle(benchmark::State& state) {
   while (state.KeepRunning()) {
     Elements elements;
@@ -82,5 +114,134 @@ BENCHMARK(BenchmarkStyle)
         benchmark::CreateDenseRange(10, 200, 20),  // Screen width.
     });
 
+static void BenchmarkGradientOverlay(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    auto document = text("Test") |
+                    bgcolor(LinearGradient(45, Color::RGB(255, 0, 0),
+                                           Color::RGB(0, 0, 255))) |
+                    bgcolor(Color::RGBA(0, 0, 0, 128)) |
+                    color(Color::RGBA(255, 255, 255, 64)) | flex;
+    Screen screen(state.range(0), state.range(0));
+    Render(screen, document);
+    screen.ToString();
+  }
+}
+BENCHMARK(BenchmarkGradientOverlay)->DenseRange(0, 256, 64);
+
+// A 4K terminal, serialized using a varying number of threads.
+static void BenchmarkToStringParallel(benchmark::State& state) {
+  auto document = text("Test") |
+                  bgcolor(LinearGradient(45, Color::RGB(255, 0, 0),
+                                         Color::RGB(0, 0, 255))) |
+                  flex;
+  Screen screen(600, 200);
+  Render(screen, document);
+  screen.SetSerializationThreads(state.range(0));
+  std::string output;
+  while (state.KeepRunning()) {
+    output.clear();
+    screen.ToString(output);
+  }
+}
+BENCHMARK(BenchmarkToStringParallel)->DenseRange(1, 8, 1)->UseRealTime();
+
+// Build and render a dashboard-like document, made of many small elements.
+// The argument selects whether they are allocated from a FrameArena.
+static void BenchmarkFrameArena(benchmark::State& state) {
+  FrameArena arena;
+  Screen screen(200, 60);
+  for (auto _ : state) {
+    arena.Reset();
+    std::optional<FrameArena::Scope> scope;
+    if (state.range(0)) {
+      scope.emplace(arena);
+    }
+    Elements rows;
+    for (int i = 0; i < 60; ++i) {
+      rows.push_back(hbox({
+          text("name") | bold | flex,
+          separator(),
+          text("value") | color(Color::Red),
+          separator(),
+          gauge(0.5f) | size(WIDTH, EQUAL, 20),
+      }));
+    }
+    auto document = vbox(std::move(rows)) | border;
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkFrameArena)->Arg(0)->Arg(1);
+
+// A paragraph, requesting additional iterations of the layout, beside a varying
+// number of unrelated elements. Only the paragraph and its ancestors are laid
+// out again.
+static void BenchmarkIncrementalLayout(benchmark::State& state) {
+  Elements rows;
+  for (int i = 0; i < state.range(0); ++i) {
+    rows.push_back(hbox({
+        text("name") | bold | flex,
+        separator(),
+        text("value") | color(Color::Red),
+    }));
+  }
+  auto document = vbox({
+      paragraph("The quick brown fox jumps over the lazy dog. ") | border,
+      vbox(std::move(rows)) | border,
+  });
+  Screen screen(20, 10);
+  for (auto _ : state) {
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkIncrementalLayout)->RangeMultiplier(10)->Range(10, 10000);
+
+// A scrollable list of log lines. Only the visible rows are built.
+static void BenchmarkVirtualList(benchmark::State& state) {
+  const int count = state.range(0);
+  Screen screen(80, 60);
+  for (auto _ : state) {
+    auto document =
+        virtualList(count, 1,
+                    [](int i) { return text("line " + std::to_string(i)); }) |
+        focusPosition(0, count / 2) | vscroll_indicator | yframe;
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkVirtualList)->RangeMultiplier(100)->Range(100, 1000000);
+
+// A flow of words, rendered again every frame. They overflow the screen.
+static void BenchmarkFlexbox(benchmark::State& state) {
+  Elements words;
+  for (int i = 0; i < state.range(0); ++i) {
+    words.push_back(text("word" + std::to_string(i)));
+  }
+  auto document = hflow(std::move(words)) | border;
+  Screen screen(80, 60);
+  for (auto _ : state) {
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkFlexbox)->Arg(1000)->Arg(10000);
+
+// A table of 50 columns, scrolled inside a frame. The table is kept across
+// frames, and only the visible rows are built.
+static void BenchmarkLargeTable(benchmark::State& state) {
+  auto table = Table(50, state.range(0), [](int column, int row) {
+    return text(std::to_string(column * row));
+  });
+  table.SampleRows(100);
+  table.SelectAll().Border(LIGHT);
+  table.SelectAll().SeparatorVertical(LIGHT);
+  table.SelectRow(0).BorderBottom(LIGHT);
+  table.SelectRows(1, -1).DecorateCellsAlternateRow(inverted);
+  Screen screen(200, 60);
+  int selected = 0;
+  for (auto _ : state) {
+    selected = (selected + 7) % state.range(0);
+    Render(screen, table.Render() | focusPosition(0, 2 * selected) | yframe);
+  }
+}
+BENCHMARK(BenchmarkLargeTable)->Arg(1000)->Arg(100000);
+
 }  // namespace ftxui
 // NOLINTEND
@@ -5,6 +5,7 @@
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, blink
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
@@ -31,7 +32,7 @@ class Blink : public NodeDecorator {
 /// @brief The text drawn alternates in between visible and hidden.
 /// @ingroup dom
 Element blink(Element child) {
-  return std::make_shared<Blink>(std::move(child));
+  return MakeNode<Blink>(std::move(child));
 }
 
 }  // namespace ftxui
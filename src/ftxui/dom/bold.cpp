@@ -5,6 +5,7 @@
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, bold
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
@@ -31,7 +32,7 @@ class Bold : public NodeDecorator {
 /// @brief Use a bold font, for elements with more emphasis.
 /// @ingroup dom
 Element bold(Element child) {
-  return std::make_shared<Bold>(std::move(child));
+  return MakeNode<Bold>(std::move(child));
 }
 
 }  // namespace ftxui
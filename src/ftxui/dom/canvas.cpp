@@ -17,10 +17,12 @@
 #include <functional>              // for function
 #include <map>                     // for map
 #include <memory>                  // for make_shared
+#include <string>                  // for string
 #include <utility>                 // for move, pair
 #include <vector>                  // for vector
 
 #include "ftxui/dom/elements.hpp"     // for Element, canvas
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -151,8 +153,10 @@ void Canvas::DrawPointOn(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  std::string character = cell.content.character;
+  character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
+  character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell.content.character = character;
 }
 
 /// @brief Erase a braille dot.
@@ -168,8 +172,10 @@ void Canvas::DrawPointOff(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
-  cell.content.character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  std::string character = cell.content.character;
+  character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
+  character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  cell.content.character = character;
 }
 
 /// @brief Toggle a braille dot. A filled one will be erased, and the other will
@@ -186,8 +192,10 @@ void Canvas::DrawPointToggle(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  std::string character = cell.content.character;
+  character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
+  character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell.content.character = character;
 }
 
 /// @brief Draw a line made of braille dots.
@@ -911,7 +919,7 @@ Element canvas(ConstRef<Canvas> canvas) {
     const Canvas& canvas() final { return *canvas_; }
     ConstRef<Canvas> canvas_;
   };
-  return std::make_shared<Impl>(canvas);
+  return MakeNode<Impl>(canvas);
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
@@ -946,7 +954,7 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
     int height_;
     std::function<void(Canvas&)> fn_;
   };
-  return std::make_shared<Impl>(width, height, std::move(fn));
+  return MakeNode<Impl>(width, height, std::move(fn));
 }
 
 /// @brief Produce an element drawing a canvas.
@@ -5,6 +5,7 @@
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, clear_under
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
@@ -36,7 +37,7 @@ class ClearUnder : public NodeDecorator {
 /// @see ftxui::dbox
 /// @ingroup dom
 Element clear_under(Element element) {
-  return std::make_shared<ClearUnder>(std::move(element));
+  return MakeNode<ClearUnder>(std::move(element));
 }
 
 }  // namespace ftxui
@@ -3,8 +3,10 @@
 // the LICENSE file.
 #include <memory>   // for make_shared
 #include <utility>  // for move
+#include <vector>   // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/elements.hpp"        // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
 #include "ftxui/screen/color.hpp"        // for Color
@@ -13,6 +15,30 @@
 namespace ftxui {
 
 namespace {
+
+// Blend a translucent `color` over the `field` of every cell of `box`. The
+// colors are processed one row at a time, using the batched Color::Blend.
+void BlendRows(Screen& screen,
+               Box box,
+               Color Cell::*field,
+               const Color& color,
+               std::vector<Color>& row) {
+  box = Box::Intersection(box, screen.stencil);
+  if (box.x_max < box.x_min) {
+    return;
+  }
+  row.resize(static_cast<size_t>(box.x_max - box.x_min + 1));
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    for (int x = box.x_min; x <= box.x_max; ++x) {
+      row[x - box.x_min] = screen.CellAt(x, y).*field;
+    }
+    Color::Blend(row.data(), color, row.size());
+    for (int x = box.x_min; x <= box.x_max; ++x) {
+      screen.CellAt(x, y).*field = row[x - box.x_min];
+    }
+  }
+}
+
 class BgColor : public NodeDecorator {
  public:
   BgColor(Element child, Color color)
@@ -26,17 +52,13 @@ class BgColor : public NodeDecorator {
         }
       }
     } else {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          Color& color = screen.CellAt(x, y).background_color;
-          color = Color::Blend(color, color_);
-        }
-      }
+      BlendRows(screen, box_, &Cell::background_color, color_, row_);
     }
     NodeDecorator::Render(screen);
   }
 
   Color color_;
+  std::vector<Color> row_;
 };
 
 class FgColor : public NodeDecorator {
@@ -52,17 +74,13 @@ class FgColor : public NodeDecorator {
         }
       }
     } else {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          Color& color = screen.CellAt(x, y).foreground_color;
-          color = Color::Blend(color, color_);
-        }
-      }
+      BlendRows(screen, box_, &Cell::foreground_color, color_, row_);
     }
     NodeDecorator::Render(screen);
   }
 
   Color color_;
+  std::vector<Color> row_;
 };
 
 }  // namespace
@@ -79,7 +97,7 @@ class FgColor : public NodeDecorator {
 /// Element document = color(Color::Green, text("Success")),
 /// ```
 Element color(Color color, Element child) {
-  return std::make_shared<FgColor>(std::move(child), color);
+  return MakeNode<FgColor>(std::move(child), color);
 }
 
 /// @brief Set the background color of an element.
@@ -94,7 +112,7 @@ Element color(Color color, Element child) {
 /// Element document = bgcolor(Color::Green, text("Success")),
 /// ```
 Element bgcolor(Color color, Element child) {
-  return std::make_shared<BgColor>(std::move(child), color);
+  return MakeNode<BgColor>(std::move(child), color);
 }
 
 /// @brief Decorate using a foreground color.
@@ -0,0 +1,54 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_COUNTED_TEST_HELPER_HPP
+#define FTXUI_DOM_COUNTED_TEST_HELPER_HPP
+
+#include <memory>   // for make_shared
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"   // for Element
+#include "ftxui/dom/node.hpp"       // for Node
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+// Count the steps of the layout and of the rendering of an element. Test only.
+struct Counters {
+  int compute_requirement = 0;
+  int set_box = 0;
+  int render = 0;
+};
+
+// Forward every step to |child|, counting them into |counters|.
+class CountedNode : public Node {
+ public:
+  CountedNode(Element child, Counters& counters)
+      : Node({std::move(child)}), counters_(counters) {}
+
+  void ComputeRequirement() override {
+    counters_.compute_requirement++;
+    Node::ComputeRequirement();
+  }
+  void SetBox(Box box) override {
+    counters_.set_box++;
+    Node::SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
+  }
+  void Render(Screen& screen) override {
+    counters_.render++;
+    Node::Render(screen);
+  }
+
+ private:
+  Counters& counters_;
+};
+
+inline Element Counted(Element child, Counters& counters) {
+  return std::make_shared<CountedNode>(std::move(child), counters);
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_COUNTED_TEST_HELPER_HPP
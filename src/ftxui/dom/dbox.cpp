@@ -7,6 +7,7 @@
 
 #include "ftxui/dom/elements.hpp"  // for Element, dbox
 
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -21,7 +22,7 @@ class DBox : public Node {
   void ComputeRequirement() override {
     requirement_ = Requirement{};
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->ComputeRequirementIfNeeded();
 
       // Extend the min_x and min_y to contain all the children
       requirement_.min_x =
@@ -46,7 +47,7 @@ class DBox : public Node {
     Node::SetBox(box);
 
     for (auto& child : children_) {
-      child->SetBox(box);
+      child->SetBoxIfNeeded(box);
     }
   }
 };
@@ -57,7 +58,7 @@ class DBox : public Node {
 /// @return The right aligned element.
 /// @ingroup dom
 Element dbox(Elements children_) {
-  return std::make_shared<DBox>(std::move(children_));
+  return MakeNode<DBox>(std::move(children_));
 }
 
 }  // namespace ftxui
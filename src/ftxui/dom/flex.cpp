@@ -4,8 +4,9 @@
 #include <memory>   // for make_shared, __shared_ptr_access
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, filler, flex, flex_grow, flex_shrink, notflex, xflex, xflex_grow, xflex_shrink, yflex, yflex_grow, yflex_shrink
-#include "ftxui/dom/node.hpp"      // for Elements, Node
+#include "ftxui/dom/elements.hpp"     // for Element, unpack, filler, flex, flex_grow, flex_shrink, notflex, xflex, xflex_grow, xflex_shrink, yflex, yflex_grow, yflex_shrink
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
+#include "ftxui/dom/node.hpp"         // for Elements, Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 
@@ -31,7 +32,7 @@ class Flex : public Node {
     requirement_.min_x = 0;
     requirement_.min_y = 0;
     if (!children_.empty()) {
-      children_[0]->ComputeRequirement();
+      children_[0]->ComputeRequirementIfNeeded();
       requirement_ = children_[0]->requirement();
     }
     if (grow_x_ != -1) {
@@ -53,7 +54,7 @@ class Flex : public Node {
     if (children_.empty()) {
       return;
     }
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
   }
 
   int grow_x_;
@@ -68,7 +69,7 @@ class Flex : public Node {
 /// a container.
 /// @ingroup dom
 Element filler() {
-  return std::make_shared<Flex>(1, 1, 1, 1);
+  return MakeNode<Flex>(1, 1, 1, 1);
 }
 
 /// @brief Make a child element to expand proportionally to the space left in a
@@ -93,114 +94,114 @@ Element filler() {
 /// └────┘└─────────────────────────────────────────────────────────┘└─────┘
 /// ~~~
 Element flex(Element child) {
-  return std::make_shared<Flex>(std::move(child), 1, 1, 1, 1);
+  return MakeNode<Flex>(std::move(child), 1, 1, 1, 1);
 }
 
 /// @brief Expand/Minimize if possible/needed on the X axis.
 /// @ingroup dom
 Element xflex(Element child) {
-  return std::make_shared<Flex>(std::move(child), 1, -1, 1, -1);
+  return MakeNode<Flex>(std::move(child), 1, -1, 1, -1);
 }
 
 /// @brief Expand/Minimize if possible/needed on the Y axis.
 /// @ingroup dom
 Element yflex(Element child) {
-  return std::make_shared<Flex>(std::move(child), -1, 1, -1, 1);
+  return MakeNode<Flex>(std::move(child), -1, 1, -1, 1);
 }
 
 /// @brief Expand if possible.
 /// @ingroup dom
 Element flex_grow(Element child) {
-  return std::make_shared<Flex>(std::move(child), 1, 1, -1, -1);
+  return MakeNode<Flex>(std::move(child), 1, 1, -1, -1);
 }
 
 /// @brief Expand if possible on the X axis.
 /// @ingroup dom
 Element xflex_grow(Element child) {
-  return std::make_shared<Flex>(std::move(child), 1, -1, -1, -1);
+  return MakeNode<Flex>(std::move(child), 1, -1, -1, -1);
 }
 
 /// @brief Expand if possible on the Y axis.
 /// @ingroup dom
 Element yflex_grow(Element child) {
-  return std::make_shared<Flex>(std::move(child), -1, 1, -1, -1);
+  return MakeNode<Flex>(std::move(child), -1, 1, -1, -1);
 }
 
 /// @brief Minimize if needed.
 /// @ingroup dom
 Element flex_shrink(Element child) {
-  return std::make_shared<Flex>(std::move(child), -1, -1, 1, 1);
+  return MakeNode<Flex>(std::move(child), -1, -1, 1, 1);
 }
 
 /// @brief Minimize if needed on the X axis.
 /// @ingroup dom
 Element xflex_shrink(Element child) {
-  return std::make_shared<Flex>(std::move(child), -1, -1, 1, -1);
+  return MakeNode<Flex>(std::move(child), -1, -1, 1, -1);
 }
 
 /// @brief Minimize if needed on the Y axis.
 /// @ingroup dom
 Element yflex_shrink(Element child) {
-  return std::make_shared<Flex>(std::move(child), -1, -1, -1, 1);
+  return MakeNode<Flex>(std::move(child), -1, -1, -1, 1);
 }
 
 /// @brief Make the element not flexible.
 /// @ingroup dom
 Element notflex(Element child) {
-  return std::make_shared<Flex>(std::move(child), 0, 0, 0, 0);
+  return MakeNode<Flex>(std::move(child), 0, 0, 0, 0);
 }
 
 Decorator flex_factor(int grow, int shrink) {
   return [grow, shrink](Element child) {
-    return std::make_shared<Flex>(std::move(child), grow, grow, shrink, shrink);
+    return MakeNode<Flex>(std::move(child), grow, grow, shrink, shrink);
   };
 }
 
 Decorator flex_grow_factor(int grow) {
   return [grow](Element child) {
-    return std::make_shared<Flex>(std::move(child), grow, grow, -1, -1);
+    return MakeNode<Flex>(std::move(child), grow, grow, -1, -1);
   };
 }
 
 Decorator flex_shrink_factor(int shrink) {
   return [shrink](Element child) {
-    return std::make_shared<Flex>(std::move(child), -1, -1, shrink, shrink);
+    return MakeNode<Flex>(std::move(child), -1, -1, shrink, shrink);
   };
 }
 
 Decorator xflex_factor(int grow, int shrink) {
   return [grow, shrink](Element child) {
-    return std::make_shared<Flex>(std::move(child), grow, -1, shrink, -1);
+    return MakeNode<Flex>(std::move(child), grow, -1, shrink, -1);
   };
 }
 
 Decorator xflex_grow_factor(int grow) {
   return [grow](Element child) {
-    return std::make_shared<Flex>(std::move(child), grow, -1, -1, -1);
+    return MakeNode<Flex>(std::move(child), grow, -1, -1, -1);
   };
 }
 
 Decorator xflex_shrink_factor(int shrink) {
   return [shrink](Element child) {
-    return std::make_shared<Flex>(std::move(child), -1, -1, shrink, -1);
+    return MakeNode<Flex>(std::move(child), -1, -1, shrink, -1);
   };
 }
 
 Decorator yflex_factor(int grow, int shrink) {
   return [grow, shrink](Element child) {
-    return std::make_shared<Flex>(std::move(child), -1, grow, -1, shrink);
+    return MakeNode<Flex>(std::move(child), -1, grow, -1, shrink);
   };
 }
 
 Decorator yflex_grow_factor(int grow) {
   return [grow](Element child) {
-    return std::make_shared<Flex>(std::move(child), -1, grow, -1, -1);
+    return MakeNode<Flex>(std::move(child), -1, grow, -1, -1);
   };
 }
 
 Decorator yflex_shrink_factor(int shrink) {
   return [shrink](Element child) {
-    return std::make_shared<Flex>(std::move(child), -1, -1, -1, shrink);
+    return MakeNode<Flex>(std::move(child), -1, -1, -1, shrink);
   };
 }
 
@@ -8,9 +8,10 @@
 #include <utility>  // for move, swap
 #include <vector>   // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, Elements, flexbox, hflow, vflow
+#include "ftxui/dom/elements.hpp"        // for Element, Elements, flexbox, hflow, vflow
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::Direction::Column, FlexboxConfig::AlignContent, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::Wrap::Wrap
 #include "ftxui/dom/flexbox_helper.hpp"  // for Block, Global, Compute
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node.hpp"            // for Node, Elements, Node::Status
 #include "ftxui/dom/requirement.hpp"     // for Requirement
 #include "ftxui/dom/selection.hpp"       // for Selection
@@ -71,40 +72,69 @@ class Flexbox : public Node {
            config_.direction == FlexboxConfig::Direction::ColumnInversed;
   }
 
-  void Layout(flexbox_helper::Global& global,
+  flexbox_helper::Block MakeBlock(const Element& child,
+                                  bool compute_requirement) const {
+    flexbox_helper::Block block;
+    block.min_size_x = child->requirement().min_x;
+    block.min_size_y = child->requirement().min_y;
+    if (!compute_requirement) {
+      block.flex_grow_x = child->requirement().flex_grow_x;
+      block.flex_grow_y = child->requirement().flex_grow_y;
+      block.flex_shrink_x = child->requirement().flex_shrink_x;
+      block.flex_shrink_y = child->requirement().flex_shrink_y;
+    }
+    return block;
+  }
+
+  static bool SameInput(const flexbox_helper::Block& a,
+                        const flexbox_helper::Block& b) {
+    return a.min_size_x == b.min_size_x && a.min_size_y == b.min_size_y &&
+           a.flex_grow_x == b.flex_grow_x && a.flex_grow_y == b.flex_grow_y &&
+           a.flex_shrink_x == b.flex_shrink_x &&
+           a.flex_shrink_y == b.flex_shrink_y;
+  }
+
+  // Lay out the children into |global|, within |size_x| x |size_y|. This is
+  // skipped when |global| already holds the layout of the same children
+  // requirements, within the same size. Returns whether it was computed.
+  bool Layout(flexbox_helper::Global& global,
+              int size_x,
+              int size_y,
               bool compute_requirement = false) {
+    bool same = global.size_x == size_x && global.size_y == size_y &&
+                global.blocks.size() == children_.size();
+    for (size_t i = 0; same && i < children_.size(); ++i) {
+      same = SameInput(global.blocks[i],
+                       MakeBlock(children_[i], compute_requirement));
+    }
+    if (same) {
+      return false;
+    }
+
+    global.blocks.clear();
+    global.lines.clear();
+    global.config = compute_requirement ? config_normalized_ : config_;
+    global.size_x = size_x;
+    global.size_y = size_y;
     global.blocks.reserve(children_.size());
     for (auto& child : children_) {
-      flexbox_helper::Block block;
-      block.min_size_x = child->requirement().min_x;
-      block.min_size_y = child->requirement().min_y;
-      if (!compute_requirement) {
-        block.flex_grow_x = child->requirement().flex_grow_x;
-        block.flex_grow_y = child->requirement().flex_grow_y;
-        block.flex_shrink_x = child->requirement().flex_shrink_x;
-        block.flex_shrink_y = child->requirement().flex_shrink_y;
-      }
-      global.blocks.push_back(block);
+      global.blocks.push_back(MakeBlock(child, compute_requirement));
     }
 
     flexbox_helper::Compute(global);
+    return true;
   }
 
   void ComputeRequirement() override {
     requirement_ = Requirement{};
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->ComputeRequirementIfNeeded();
     }
-    global_ = flexbox_helper::Global();
-    global_.config = config_normalized_;
     if (IsColumnOriented()) {
-      global_.size_x = 100000;  // NOLINT
-      global_.size_y = asked_;
+      Layout(global_, 100000, asked_, true);  // NOLINT
     } else {
-      global_.size_x = asked_;
-      global_.size_y = 100000;  // NOLINT
+      Layout(global_, asked_, 100000, true);  // NOLINT
     }
-    Layout(global_, true);
 
     if (global_.blocks.empty()) {
       return;
@@ -146,15 +176,14 @@ class Flexbox : public Node {
                                                  : box.x_max - box.x_min + 1);
     need_iteration_ = (asked_ != asked_previous);
 
-    flexbox_helper::Global global;
-    global.config = config_;
-    global.size_x = box.x_max - box.x_min + 1;
-    global.size_y = box.y_max - box.y_min + 1;
-    Layout(global);
+    // When the layout is the same as the previous one, the clipped children
+    // already got the iteration they needed to adapt.
+    const bool changed = Layout(layout_, box.x_max - box.x_min + 1,
+                                box.y_max - box.y_min + 1);
 
     for (size_t i = 0; i < children_.size(); ++i) {
       auto& child = children_[i];
-      auto& b = global.blocks[i];
+      auto& b = layout_.blocks[i];
 
       Box children_box;
       children_box.x_min = box.x_min + b.x;
@@ -163,9 +192,9 @@ class Flexbox : public Node {
       children_box.y_max = box.y_min + b.y + b.dim_y - 1;
 
       const Box intersection = Box::Intersection(children_box, box);
-      child->SetBox(intersection);
+      child->SetBoxIfNeeded(intersection);
 
-      need_iteration_ |= (intersection != children_box);
+      need_iteration_ |= changed && (intersection != children_box);
     }
   }
 
@@ -209,7 +238,7 @@ class Flexbox : public Node {
 
   void Check(Status* status) override {
     for (auto& child : children_) {
-      child->Check(status);
+      child->CheckIfNeeded(status);
     }
 
     if (status->iteration == 0) {
@@ -224,7 +253,8 @@ class Flexbox : public Node {
   bool need_iteration_ = true;
   const FlexboxConfig config_;
   const FlexboxConfig config_normalized_;
-  flexbox_helper::Global global_;
+  flexbox_helper::Global global_;  // The layout computing the requirement.
+  flexbox_helper::Global layout_;  // The layout within |box_|.
 };
 
 }  // namespace
@@ -235,6 +265,12 @@ class Flexbox : public Node {
 /// @param config The option
 /// @return The container.
 ///
+/// The layout is kept by the element, and only computed again when its size or
+/// the requirements of its children change. This helps across the iterations
+/// of the layout of a frame, and for elements kept from one frame to the next,
+/// e.g. using `memo`. An element built again every frame, like the ones
+/// returned by a component's `Render`, starts without a layout.
+///
 /// #### Example
 ///
 /// ```cpp
@@ -250,7 +286,7 @@ class Flexbox : public Node {
 /// )
 /// ```
 Element flexbox(Elements children, FlexboxConfig config) {
-  return std::make_shared<Flexbox>(std::move(children), config);
+  return MakeNode<Flexbox>(std::move(children), config);
 }
 
 /// @brief A container displaying elements in rows from left to right. When
@@ -42,8 +42,8 @@ struct Global {
   std::vector<Block> blocks;
   std::vector<Line> lines;
   FlexboxConfig config;
-  int size_x;
-  int size_y;
+  int size_x = 0;
+  int size_y = 0;
 };
 
 void Compute(Global& global);
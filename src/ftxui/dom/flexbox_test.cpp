@@ -4,10 +4,11 @@
 #include <gtest/gtest.h>
 #include <string>  // for allocator
 
-#include "ftxui/dom/elements.hpp"        // for text, flexbox
-#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::AlignContent, FlexboxConfig::JustifyContent, FlexboxConfig::Direction::Column, FlexboxConfig::AlignItems, FlexboxConfig::JustifyContent::SpaceAround, FlexboxConfig::AlignContent::Center, FlexboxConfig::AlignContent::FlexEnd, FlexboxConfig::AlignContent::SpaceAround, FlexboxConfig::AlignContent::SpaceBetween, FlexboxConfig::AlignContent::SpaceEvenly, FlexboxConfig::AlignItems::Center, FlexboxConfig::AlignItems::FlexEnd, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::SpaceBetween
-#include "ftxui/dom/node.hpp"            // for Render
-#include "ftxui/screen/screen.hpp"       // for Screen
+#include "ftxui/dom/counted_test_helper.hpp"  // for Counted, Counters
+#include "ftxui/dom/elements.hpp"             // for text, flexbox
+#include "ftxui/dom/flexbox_config.hpp"       // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::AlignContent, FlexboxConfig::JustifyContent, FlexboxConfig::Direction::Column, FlexboxConfig::AlignItems, FlexboxConfig::JustifyContent::SpaceAround, FlexboxConfig::AlignContent::Center, FlexboxConfig::AlignContent::FlexEnd, FlexboxConfig::AlignContent::SpaceAround, FlexboxConfig::AlignContent::SpaceBetween, FlexboxConfig::AlignContent::SpaceEvenly, FlexboxConfig::AlignItems::Center, FlexboxConfig::AlignItems::FlexEnd, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::SpaceBetween
+#include "ftxui/dom/node.hpp"                 // for Render
+#include "ftxui/screen/screen.hpp"            // for Screen
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -457,5 +458,53 @@ TEST(FlexboxTest, Focus) {
             "-");
 }
 
+// The clipped children don't make the layout iterate until the limit is
+// reached.
+TEST(FlexboxTest, ClippedLayoutIsStable) {
+  Counters counters;
+  auto document = Counted(hflow({
+                              text("aaa"),
+                              text("bbb"),
+                              text("ccc"),
+                              text("ddd"),
+                          }),
+                          counters);
+  Screen screen(3, 2);
+  Render(screen, document);
+  EXPECT_EQ(screen.ToString(),
+            "aaa\r\n"
+            "bbb");
+  // The requirement is computed once per iteration of the layout.
+  EXPECT_EQ(counters.compute_requirement, 2);
+}
+
+// The layout is kept by the node. When the same element is laid out again,
+// e.g. from one frame to the next, the layout is only computed again if the
+// size or the requirements of the children changed.
+TEST(FlexboxTest, RetainedLayout) {
+  auto words = [] {
+    return hflow({
+        text("aaa"),
+        text("bbb"),
+        text("ccc"),
+        text("ddd"),
+    });
+  };
+  Counters counters;
+  auto document = Counted(words(), counters);
+
+  for (int width : {3, 3, 7, 3}) {
+    Screen screen(width, 2);
+    Screen reference(width, 2);
+    const int before = counters.compute_requirement;
+    Render(screen, document);
+    Render(reference, words());
+    EXPECT_EQ(screen.ToString(), reference.ToString());
+    // The clipped children get one more iteration, whether the layout is
+    // computed again or reused.
+    EXPECT_EQ(counters.compute_requirement - before, 2);
+  }
+}
+
 }  // namespace ftxui
 // NOLINTEND
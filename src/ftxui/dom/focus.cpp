@@ -4,10 +4,11 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Decorator, Element, focusPosition, focusPositionRelative
+#include "ftxui/dom/elements.hpp"        // for Decorator, Element, focusPosition, focusPositionRelative
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::NORMAL, Requirement::Selection
-#include "ftxui/screen/box.hpp"  // for Box
+#include "ftxui/dom/requirement.hpp"     // for Requirement, Requirement::NORMAL, Requirement::Selection
+#include "ftxui/screen/box.hpp"          // for Box
 
 namespace ftxui {
 
@@ -50,7 +51,7 @@ Decorator focusPositionRelative(float x, float y) {
   };
 
   return [x, y](Element child) {
-    return std::make_shared<Impl>(std::move(child), x, y);
+    return MakeNode<Impl>(std::move(child), x, y);
   };
 }
 
@@ -89,7 +90,7 @@ Decorator focusPosition(int x, int y) {
   };
 
   return [x, y](Element child) {
-    return std::make_shared<Impl>(std::move(child), x, y);
+    return MakeNode<Impl>(std::move(child), x, y);
   };
 }
 
@@ -5,7 +5,8 @@
 #include <memory>     // for make_shared, __shared_ptr_access
 #include <utility>    // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, Elements, focus, frame, select, xframe, yframe
+#include "ftxui/dom/elements.hpp"     // for Element, unpack, Elements, focus, frame, select, xframe, yframe
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -32,7 +33,7 @@ class FocusNode : public Node {
 
   void SetBox(Box box) override {
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
   }
 };
 
@@ -66,7 +67,7 @@ class Frame : public Node {
       children_box.y_max = box.y_min + internal_dimy - dy;
     }
 
-    children_[0]->SetBox(children_box);
+    children_[0]->SetBoxIfNeeded(children_box);
   }
 
   void Render(Screen& screen) override {
@@ -99,7 +100,7 @@ class FocusCursorNode : public FocusNode {
 /// @param child The element to be focused.
 /// @ingroup dom
 Element focus(Element child) {
-  return std::make_shared<FocusNode>(unpack(std::move(child)));
+  return MakeNode<FocusNode>(unpack(std::move(child)));
 }
 
 /// This is deprecated. Use `focus` instead.
@@ -116,7 +117,7 @@ Element select(Element e) {
 /// @see xframe
 /// @see yframe
 Element frame(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, true);
+  return MakeNode<Frame>(unpack(std::move(child)), true, true);
 }
 
 /// @brief Same as `frame`, but only on the x-axis.
@@ -124,7 +125,7 @@ Element frame(Element child) {
 /// @see xframe
 /// @see yframe
 Element xframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, false);
+  return MakeNode<Frame>(unpack(std::move(child)), true, false);
 }
 
 /// @brief Same as `frame`, but only on the y-axis.
@@ -132,7 +133,7 @@ Element xframe(Element child) {
 /// @see xframe
 /// @see yframe
 Element yframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), false, true);
+  return MakeNode<Frame>(unpack(std::move(child)), false, true);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a still block.
@@ -145,8 +146,8 @@ Element yframe(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBlock(Element child) {
-  return std::make_shared<FocusCursorNode>(unpack(std::move(child)),
-                                           Screen::Cursor::Block);
+  return MakeNode<FocusCursorNode>(unpack(std::move(child)),
+                                   Screen::Cursor::Block);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a blinking block.
@@ -159,8 +160,8 @@ Element focusCursorBlock(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBlockBlinking(Element child) {
-  return std::make_shared<FocusCursorNode>(unpack(std::move(child)),
-                                           Screen::Cursor::BlockBlinking);
+  return MakeNode<FocusCursorNode>(unpack(std::move(child)),
+                                   Screen::Cursor::BlockBlinking);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a still block.
@@ -173,8 +174,8 @@ Element focusCursorBlockBlinking(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBar(Element child) {
-  return std::make_shared<FocusCursorNode>(unpack(std::move(child)),
-                                           Screen::Cursor::Bar);
+  return MakeNode<FocusCursorNode>(unpack(std::move(child)),
+                                   Screen::Cursor::Bar);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a blinking bar.
@@ -187,8 +188,8 @@ Element focusCursorBar(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBarBlinking(Element child) {
-  return std::make_shared<FocusCursorNode>(unpack(std::move(child)),
-                                           Screen::Cursor::BarBlinking);
+  return MakeNode<FocusCursorNode>(unpack(std::move(child)),
+                                   Screen::Cursor::BarBlinking);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a still underline.
@@ -201,8 +202,8 @@ Element focusCursorBarBlinking(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorUnderline(Element child) {
-  return std::make_shared<FocusCursorNode>(unpack(std::move(child)),
-                                           Screen::Cursor::Underline);
+  return MakeNode<FocusCursorNode>(unpack(std::move(child)),
+                                   Screen::Cursor::Underline);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a blinking underline.
@@ -215,8 +216,8 @@ Element focusCursorUnderline(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorUnderlineBlinking(Element child) {
-  return std::make_shared<FocusCursorNode>(unpack(std::move(child)),
-                                           Screen::Cursor::UnderlineBlinking);
+  return MakeNode<FocusCursorNode>(unpack(std::move(child)),
+                                   Screen::Cursor::UnderlineBlinking);
 }
 
 }  // namespace ftxui
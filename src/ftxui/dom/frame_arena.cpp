@@ -0,0 +1,122 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/frame_arena.hpp"
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t, max_align_t
+#include <new>      // for operator new, operator delete
+
+namespace ftxui {
+
+// A block of memory. It is referenced by the arena, and by every allocation
+// not yet released. The data follows it.
+struct FrameArena::Block {
+  std::atomic<size_t> references{1};
+};
+
+namespace {
+
+// Every allocation is preceded by a header, pointing to its block. It is null
+// for the allocations from the heap.
+constexpr size_t kAlignment = alignof(std::max_align_t);
+constexpr size_t kHeader = kAlignment;
+constexpr size_t kBlockSize = 64 * 1024;
+// Larger allocations are made from the heap.
+constexpr size_t kMaxSize = kBlockSize / 8;
+
+constexpr size_t RoundUp(size_t size) {
+  return (size + kAlignment - 1) / kAlignment * kAlignment;
+}
+constexpr size_t kBlockData = RoundUp(sizeof(FrameArena::Block));
+
+thread_local FrameArena* g_active = nullptr;  // NOLINT
+
+char* Data(FrameArena::Block* block) {
+  return reinterpret_cast<char*>(block) + kBlockData;  // NOLINT
+}
+
+void Release(FrameArena::Block* block) {
+  if (block->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    block->~Block();
+    ::operator delete(block);
+  }
+}
+
+}  // namespace
+
+FrameArena::FrameArena() = default;
+
+/// @brief Destroy the arena. The blocks still holding allocations are freed
+/// once those are released.
+FrameArena::~FrameArena() {
+  for (Block* block : blocks_) {
+    Release(block);
+  }
+}
+
+/// @brief Start a new frame. The next allocations reuse the blocks whose
+/// allocations were all released.
+void FrameArena::Reset() {
+  block_ = nullptr;
+  used_ = 0;
+}
+
+FrameArena::Scope::Scope(FrameArena& arena) : previous_(g_active) {
+  g_active = &arena;
+}
+
+FrameArena::Scope::~Scope() {
+  g_active = previous_;
+}
+
+// static
+void* FrameArena::Allocate(size_t size) {
+  if (g_active != nullptr && size <= kMaxSize) {
+    return g_active->AllocateFromBlock(size);
+  }
+  char* data = static_cast<char*>(::operator new(kHeader + size));
+  *reinterpret_cast<Block**>(data) = nullptr;  // NOLINT
+  return data + kHeader;
+}
+
+// static
+void FrameArena::Deallocate(void* pointer) noexcept {
+  if (pointer == nullptr) {
+    return;
+  }
+  char* data = static_cast<char*>(pointer) - kHeader;
+  Block* block = *reinterpret_cast<Block**>(data);  // NOLINT
+  if (block == nullptr) {
+    ::operator delete(data);
+  } else {
+    Release(block);
+  }
+}
+
+void* FrameArena::AllocateFromBlock(size_t size) {
+  const size_t needed = kHeader + RoundUp(size);
+  if (block_ == nullptr || used_ + needed > kBlockSize) {
+    block_ = NextBlock();
+    used_ = 0;
+  }
+  char* data = Data(block_) + used_;
+  used_ += needed;
+  block_->references.fetch_add(1, std::memory_order_relaxed);
+  *reinterpret_cast<Block**>(data) = block_;  // NOLINT
+  return data + kHeader;
+}
+
+// Find a block whose allocations were all released, or allocate a new one.
+FrameArena::Block* FrameArena::NextBlock() {
+  for (Block* block : blocks_) {
+    if (block->references.load(std::memory_order_acquire) == 1) {
+      return block;
+    }
+  }
+  Block* block = new (::operator new(kBlockData + kBlockSize)) Block();
+  blocks_.push_back(block);
+  return block;
+}
+
+}  // namespace ftxui
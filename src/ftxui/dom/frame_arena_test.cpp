@@ -0,0 +1,109 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>  // for unique_ptr
+#include <string>  // for string, to_string
+
+#include "ftxui/dom/elements.hpp"     // for text, vbox, hbox, border, Element
+#include "ftxui/dom/frame_arena.hpp"  // for FrameArena, MakeNode
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+Element Document(int frame) {
+  Elements rows;
+  for (int i = 0; i < 100; ++i) {
+    rows.push_back(hbox({
+        text(std::to_string(frame)) | bold,
+        text(" row " + std::to_string(i)) | color(Color::Red),
+    }));
+  }
+  return vbox(std::move(rows)) | border;
+}
+
+std::string RenderDocument(const Element& document) {
+  Screen screen(20, 10);
+  Render(screen, document);
+  return screen.ToString();
+}
+}  // namespace
+
+// The elements built from an arena are the same as the ones built from the
+// heap.
+TEST(FrameArenaTest, SameOutput) {
+  FrameArena arena;
+  for (int frame = 0; frame < 10; ++frame) {
+    arena.Reset();
+    const std::string expected = RenderDocument(Document(frame));
+    FrameArena::Scope scope(arena);
+    EXPECT_EQ(RenderDocument(Document(frame)), expected);
+  }
+}
+
+// The blocks are reused from one frame to the next.
+TEST(FrameArenaTest, Reuse) {
+  FrameArena arena;
+  {
+    FrameArena::Scope scope(arena);
+    Document(0);
+  }
+  const size_t blocks = arena.BlockCount();
+  EXPECT_GT(blocks, 0u);
+
+  for (int frame = 1; frame < 100; ++frame) {
+    arena.Reset();
+    FrameArena::Scope scope(arena);
+    Document(frame);
+  }
+  EXPECT_EQ(arena.BlockCount(), blocks);
+}
+
+// An element kept from one frame to the next isn't overwritten.
+TEST(FrameArenaTest, ElementOutlivesFrame) {
+  Element kept;
+  std::string expected;
+  {
+    FrameArena arena;
+    {
+      FrameArena::Scope scope(arena);
+      kept = Document(0);
+    }
+    expected = RenderDocument(kept);
+
+    for (int frame = 1; frame < 10; ++frame) {
+      arena.Reset();
+      FrameArena::Scope scope(arena);
+      EXPECT_NE(RenderDocument(Document(frame)), expected);
+    }
+    EXPECT_EQ(RenderDocument(kept), expected);
+  }
+
+  // The arena is gone. Its block holding |kept| is freed with it.
+  EXPECT_EQ(RenderDocument(kept), expected);
+  kept = nullptr;
+}
+
+// Without an active arena, the elements are allocated from the heap. Scopes
+// can be nested.
+TEST(FrameArenaTest, Scope) {
+  FrameArena outer;
+  FrameArena inner;
+  auto heap = MakeNode<Node>();
+  EXPECT_EQ(outer.BlockCount(), 0u);
+  {
+    FrameArena::Scope outer_scope(outer);
+    {
+      FrameArena::Scope inner_scope(inner);
+      auto element = text("inner");
+    }
+    EXPECT_EQ(outer.BlockCount(), 0u);
+    auto element = text("outer");
+    EXPECT_EQ(outer.BlockCount(), 1u);
+  }
+  EXPECT_EQ(inner.BlockCount(), 1u);
+}
+
+}  // namespace ftxui
@@ -5,7 +5,8 @@
 #include <memory>                   // for allocator, make_shared
 #include <string>                   // for string
 
-#include "ftxui/dom/elements.hpp"  // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
+#include "ftxui/dom/elements.hpp"     // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -102,7 +103,7 @@ class Gauge : public Node {
       return;
     }
 
-    const auto* charset = Terminal::GetQuirks().BlockCharacters()  // NOLINT
+    const auto* charset = Terminal::GetQuirksSnapshot().block_characters  // NOLINT
                               ? charset_horizontal
                               : charset_horizontal_microsoft;
 
@@ -177,7 +178,7 @@ class Gauge : public Node {
 /// @param direction Direction of progress bars progression.
 /// @ingroup dom
 Element gaugeDirection(float progress, Direction direction) {
-  return std::make_shared<Gauge>(progress, direction);
+  return MakeNode<Gauge>(progress, direction);
 }
 
 /// @brief Draw a high definition progress bar progressing from left to right.
@@ -10,6 +10,7 @@
 #include <vector>      // for vector
 
 #include "ftxui/dom/elements.hpp"     // for GraphFunction, Element, graph
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -49,7 +50,7 @@ class Graph : public Node {
       return;
     }
 
-    const auto& current_graph_charset = Terminal::GetQuirks().BlockCharacters()
+    const auto& current_graph_charset = Terminal::GetQuirksSnapshot().block_characters
                                             ? graph_charset
                                             : graph_charset_microsoft;
 
@@ -77,7 +78,7 @@ class Graph : public Node {
 /// @brief Draw a graph using a GraphFunction.
 /// @param graph_function the function to be called to get the data.
 Element graph(GraphFunction graph_function) {
-  return std::make_shared<Graph>(std::move(graph_function));
+  return MakeNode<Graph>(std::move(graph_function));
 }
 
 }  // namespace ftxui
@@ -9,6 +9,7 @@
 
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
 #include "ftxui/dom/elements.hpp"     // for Elements, filler, Element, gridbox
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -59,7 +60,7 @@ class GridBox : public Node {
     requirement_ = Requirement{};
     for (auto& line : lines_) {
       for (auto& cell : line) {
-        cell->ComputeRequirement();
+        cell->ComputeRequirementIfNeeded();
       }
     }
 
@@ -130,7 +131,7 @@ class GridBox : public Node {
         box_x.x_min = x;
         x += elements_x[ix].size;
         box_x.x_max = x - 1;
-        lines_[iy][ix]->SetBox(box_x);
+        lines_[iy][ix]->SetBoxIfNeeded(box_x);
       }
     }
   }
@@ -176,7 +177,7 @@ class GridBox : public Node {
 /// ╰──────────╯╰──────╯╰──────────╯
 /// ```
 Element gridbox(std::vector<Elements> lines) {
-  return std::make_shared<GridBox>(std::move(lines));
+  return MakeNode<GridBox>(std::move(lines));
 }
 
 }  // namespace ftxui
@@ -9,6 +9,7 @@
 
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, hbox
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/dom/selection.hpp"    // for Selection
@@ -25,7 +26,7 @@ class HBox : public Node {
     requirement_ = Requirement{};
 
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->ComputeRequirementIfNeeded();
 
       // Propagate the focused requirement.
       if (requirement_.focused.Prefer(child->requirement().focused)) {
@@ -58,7 +59,7 @@ class HBox : public Node {
     for (size_t i = 0; i < children_.size(); ++i) {
       box.x_min = x;
       box.x_max = x + elements[i].size - 1;
-      children_[i]->SetBox(box);
+      children_[i]->SetBoxIfNeeded(box);
       x = box.x_max + 1;
     }
   }
@@ -92,7 +93,7 @@ class HBox : public Node {
 /// });
 /// ```
 Element hbox(Elements children) {
-  return std::make_shared<HBox>(std::move(children));
+  return MakeNode<HBox>(std::move(children));
 }
 
 }  // namespace ftxui
@@ -8,6 +8,7 @@
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, Decorator, hyperlink
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
 #include "ftxui/screen/screen.hpp"       // for Screen, Cell
@@ -21,7 +22,7 @@ class Hyperlink : public NodeDecorator {
       : NodeDecorator(std::move(child)), link_(std::move(link)) {}
 
   void Render(Screen& screen) override {
-    const uint8_t hyperlink_id = screen.RegisterHyperlink(link_);
+    const uint16_t hyperlink_id = screen.RegisterHyperlink(link_);
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
       for (int x = box_.x_min; x <= box_.x_max; ++x) {
         screen.CellAt(x, y).hyperlink = hyperlink_id;
@@ -50,7 +51,7 @@ class Hyperlink : public NodeDecorator {
 ///   hyperlink("https://github.com/ArthurSonzogni/FTXUI", "link");
 /// ```
 Element hyperlink(std::string_view link, Element child) {
-  return std::make_shared<Hyperlink>(std::move(child), std::string(link));
+  return MakeNode<Hyperlink>(std::move(child), std::string(link));
 }
 
 /// @brief Decorate using a hyperlink.
@@ -2,7 +2,9 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <gtest/gtest.h>  // for Test, EXPECT_EQ, Message, TestPartResult, TestInfo (ptr only), TEST
-#include <string>  // for allocator, string
+#include <cstdint>  // for uint16_t
+#include <string>   // for allocator, string, to_string
+#include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"  // for text, hyperlink, operator|, Element, hbox
 #include "ftxui/dom/node.hpp"      // for Render
@@ -39,4 +41,37 @@ TEST(HyperlinkTest, Basic) {
             "\x1B]8;;\x1B\\");
 }
 
+// More than 255 hyperlinks can be displayed at once.
+TEST(HyperlinkTest, Many) {
+  Elements links;
+  for (int i = 0; i < 1000; ++i) {
+    links.push_back(text("x") | hyperlink("https://" + std::to_string(i)));
+  }
+  auto element = hbox(std::move(links));
+
+  Screen screen(1000, 1);
+  Render(screen, element);
+
+  for (int i = 0; i < 1000; ++i) {
+    const uint16_t id = screen.CellAt(i, 0).hyperlink;
+    EXPECT_NE(id, 0u);
+    EXPECT_EQ(screen.Hyperlink(id), "https://" + std::to_string(i));
+  }
+}
+
+// The ids are kept from one frame to the next.
+TEST(HyperlinkTest, ReusedAcrossFrames) {
+  Screen screen(10, 1);
+  const uint16_t a = screen.RegisterHyperlink("https://a.com");
+  const uint16_t b = screen.RegisterHyperlink("https://b.com");
+  EXPECT_NE(a, b);
+  EXPECT_EQ(screen.RegisterHyperlink("https://a.com"), a);
+
+  screen.Clear();
+  EXPECT_EQ(screen.RegisterHyperlink("https://b.com"), b);
+  EXPECT_EQ(screen.RegisterHyperlink("https://a.com"), a);
+  EXPECT_EQ(screen.Hyperlink(a), "https://a.com");
+  EXPECT_EQ(screen.Hyperlink(b), "https://b.com");
+}
+
 }  // namespace ftxui
@@ -10,11 +10,12 @@
 #include <utility>   // for move
 #include <vector>    // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/elements.hpp"        // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/color.hpp"   // for Color, Color::Default, Color::Blue
-#include "ftxui/screen/screen.hpp"  // for Cell, Screen
+#include "ftxui/screen/color.hpp"        // for Color, Color::Default, Color::Blue
+#include "ftxui/screen/screen.hpp"       // for Cell, Screen
 
 namespace ftxui {
 namespace {
@@ -93,34 +94,52 @@ LinearGradientNormalized Normalize(LinearGradient gradient) {
   return normalized;
 }
 
-Color Interpolate(const LinearGradientNormalized& gradient, float t) {
-  // Find the right color in the gradient's stops.
+// Find the index `i` of the gradient's stop such that `t` is in
+// [positions[i-1], positions[i]].
+size_t FindStop(const LinearGradientNormalized& gradient, float t) {
   size_t i = 1;
-  while (true) {
-    // Note that `t` might be slightly greater than 1.0 due to floating point
-    // precision. This is why we need to handle the case where `t` is greater
-    // than the last stop's position.
-    // See https://github.com/ArthurSonzogni/FTXUI/issues/998
-    if (i >= gradient.positions.size()) {
-      const float half = 0.5F;
-      return Color::Interpolate(half, gradient.colors.back(),
-                                gradient.colors.back());
-    }
-    if (t <= gradient.positions[i]) {
-      break;
-    }
+  // Note that `t` might be slightly greater than 1.0 due to floating point
+  // precision. This is why we need to handle the case where `t` is greater
+  // than the last stop's position. In this case, `positions.size()` is
+  // returned.
+  // See https://github.com/ArthurSonzogni/FTXUI/issues/998
+  while (i < gradient.positions.size() && t > gradient.positions[i]) {
     ++i;
   }
+  return i;
+}
 
-  const float t0 = gradient.positions[i - 1];
-  const float t1 = gradient.positions[i - 0];
-  const float tt = (t - t0) / (t1 - t0);
-
-  const Color& c0 = gradient.colors[i - 1];
-  const Color& c1 = gradient.colors[i - 0];
-  const Color& cc = Color::Interpolate(tt, c0, c1);
+// Interpolate the gradient for every parameter of `t`. The parameters are
+// overwritten. Consecutive parameters between the same two stops are
+// interpolated in a single batch.
+void Interpolate(const LinearGradientNormalized& gradient,
+                 std::vector<float>& t,
+                 std::vector<Color>& out) {
+  out.resize(t.size());
+  size_t begin = 0;
+  while (begin < t.size()) {
+    const size_t i = FindStop(gradient, t[begin]);
+    size_t end = begin + 1;
+    while (end < t.size() && FindStop(gradient, t[end]) == i) {
+      ++end;
+    }
 
-  return cc;
+    if (i >= gradient.positions.size()) {
+      const float half = 0.5F;
+      std::fill(t.begin() + begin, t.begin() + end, half);
+      Color::Interpolate(&t[begin], gradient.colors.back(),
+                         gradient.colors.back(), &out[begin], end - begin);
+    } else {
+      const float t0 = gradient.positions[i - 1];
+      const float t1 = gradient.positions[i - 0];
+      for (size_t j = begin; j < end; ++j) {
+        t[j] = (t[j] - t0) / (t1 - t0);
+      }
+      Color::Interpolate(&t[begin], gradient.colors[i - 1],
+                         gradient.colors[i - 0], &out[begin], end - begin);
+    }
+    begin = end;
+  }
 }
 
 class LinearGradientColor : public NodeDecorator {
@@ -152,20 +171,18 @@ class LinearGradientColor : public NodeDecorator {
     const float dY = dy / (max - min);
     const float dZ = -min / (max - min);
 
-    // Project every pixel to get the color.
-    if (background_color_) {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          const float t = float(x) * dX + float(y) * dY + dZ;
-          screen.CellAt(x, y).background_color = Interpolate(gradient_, t);
-        }
+    // Project every pixel to get the color, one row at a time.
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      t_.clear();
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        t_.push_back(float(x) * dX + float(y) * dY + dZ);
       }
-    } else {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          const float t = float(x) * dX + float(y) * dY + dZ;
-          screen.CellAt(x, y).foreground_color = Interpolate(gradient_, t);
-        }
+      Interpolate(gradient_, t_, row_);
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        Cell& cell = screen.CellAt(x, y);
+        (background_color_ ? cell.background_color : cell.foreground_color) =
+            row_[x - box.x_min];
       }
     }
 
@@ -174,6 +191,8 @@ class LinearGradientColor : public NodeDecorator {
 
   LinearGradientNormalized gradient_;
   bool background_color_;
+  std::vector<float> t_;
+  std::vector<Color> row_;
 };
 
 }  // namespace
@@ -243,8 +262,8 @@ LinearGradient& LinearGradient::Stop(Color c) {
 /// color(LinearGradient{0, {Color::Red, Color::Blue}}, text("Hello"))
 /// ```
 Element color(const LinearGradient& gradient, Element child) {
-  return std::make_shared<LinearGradientColor>(std::move(child), gradient,
-                                               /*background_color*/ false);
+  return MakeNode<LinearGradientColor>(std::move(child), gradient,
+                                       /*background_color*/ false);
 }
 
 /// @brief Set the background color of an element with linear-gradient effect.
@@ -259,8 +278,8 @@ Element color(const LinearGradient& gradient, Element child) {
 /// bgcolor(LinearGradient{0, {Color::Red, Color::Blue}}, text("Hello"))
 /// ```
 Element bgcolor(const LinearGradient& gradient, Element child) {
-  return std::make_shared<LinearGradientColor>(std::move(child), gradient,
-                                               /*background_color*/ true);
+  return MakeNode<LinearGradientColor>(std::move(child), gradient,
+                                       /*background_color*/ true);
 }
 
 /// @brief Decorate using a linear-gradient effect on the foreground color.
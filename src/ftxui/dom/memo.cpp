@@ -0,0 +1,252 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/memo.hpp"
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint16_t
+#include <functional>  // for function
+#include <memory>      // for make_shared, shared_ptr
+#include <string>      // for string
+#include <utility>     // for move, pair
+#include <vector>      // for vector
+
+#include "ftxui/dom/elements.hpp"     // for Element, memo
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/selection.hpp"    // for Selection
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/surface.hpp"   // for Surface
+
+namespace ftxui {
+
+struct Memo::Internal {
+  // The element built, and the dependencies it was built from.
+  Element element;
+  size_t deps = 0;
+
+  // Whether |element| is laid out within |box|. Its requirement is the one
+  // computed last.
+  bool layout_valid = false;
+  Box box;
+
+  // Whether |cells| holds what |element| draws inside |region|, over the
+  // cells |under|. The hyperlinks of both are indices into |hyperlinks|, plus
+  // one.
+  bool render_valid = false;
+  Box region;
+  Surface under{0, 0};
+  Surface cells{0, 0};
+  std::vector<std::string> hyperlinks;
+};
+
+Memo::Memo() : internal_(std::make_shared<Internal>()) {}
+
+void Memo::Invalidate() {
+  internal_->element = nullptr;
+  internal_->layout_valid = false;
+  internal_->render_valid = false;
+}
+
+class MemoNode : public Node {
+ public:
+  MemoNode(Memo& key, size_t deps, const std::function<Element()>& builder)
+      : state_(key.internal_) {
+    if (!state_->element || state_->deps != deps) {
+      state_->element = builder();
+      state_->deps = deps;
+      state_->layout_valid = false;
+      state_->render_valid = false;
+    }
+    children_.push_back(state_->element);
+  }
+
+  void ComputeRequirement() override {
+    if (!state_->layout_valid) {
+      children_[0]->ComputeRequirement();
+    }
+    requirement_ = children_[0]->requirement();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    if (state_->layout_valid && box == state_->box) {
+      return;
+    }
+    state_->layout_valid = false;
+    state_->render_valid = false;
+    state_->box = box;
+    children_[0]->SetBox(box);
+  }
+
+  void Check(Status* status) override {
+    // The layout of the element is already resolved.
+    if (state_->layout_valid) {
+      status->need_iteration |= (status->iteration == 0);
+      return;
+    }
+    Node::Check(status);
+  }
+
+  void Select(Selection& selection) override {
+    if (Box::Intersection(selection.GetBox(), box_).IsEmpty()) {
+      return;
+    }
+    selected_ = true;
+    Node::Select(selection);
+  }
+
+  void Render(Screen& screen) override {
+    const Box region = Box::Intersection(box_, screen.stencil);
+
+    // The selection is stored into the nodes. They can't be reused.
+    if (selected_) {
+      Node::Render(screen);
+      state_->element = nullptr;
+      state_->layout_valid = false;
+      state_->render_valid = false;
+      return;
+    }
+
+    // The element is drawn over the cells below, e.g. the background of its
+    // parent. The cache is only valid over the same cells.
+    if (state_->render_valid && region == state_->region &&
+        SameUnder(screen)) {
+      Blit(screen);
+    } else {
+      state_->region = region;
+      state_->hyperlinks.clear();
+      std::vector<std::pair<uint16_t, uint16_t>> links;
+      Capture(screen, state_->under, links);
+      Node::Render(screen);
+      Capture(screen, state_->cells, links);
+      state_->render_valid = true;
+    }
+    state_->layout_valid = true;
+  }
+
+ private:
+  // Copy the cells of |state_->region| into |surface|. |links| maps the
+  // hyperlinks of the screen to their index in |state_->hyperlinks|.
+  void Capture(const Screen& screen,
+               Surface& surface,
+               std::vector<std::pair<uint16_t, uint16_t>>& links) {
+    const Box& region = state_->region;
+    const int dimx = region.IsEmpty() ? 0 : region.x_max - region.x_min + 1;
+    const int dimy = region.IsEmpty() ? 0 : region.y_max - region.y_min + 1;
+    if (surface.dimx() != dimx || surface.dimy() != dimy) {
+      surface = Surface(dimx, dimy);
+    }
+
+    for (int y = 0; y < dimy; ++y) {
+      for (int x = 0; x < dimx; ++x) {
+        Cell& cell = surface.CellAt(x, y);
+        cell = screen.CellAt(region.x_min + x, region.y_min + y);
+        if (cell.hyperlink == 0) {
+          continue;
+        }
+        auto it = links.begin();
+        while (it != links.end() && it->first != cell.hyperlink) {
+          ++it;
+        }
+        if (it == links.end()) {
+          state_->hyperlinks.push_back(screen.Hyperlink(cell.hyperlink));
+          links.emplace_back(cell.hyperlink,
+                             static_cast<uint16_t>(state_->hyperlinks.size()));
+          it = links.end() - 1;
+        }
+        cell.hyperlink = it->second;
+      }
+    }
+  }
+
+  // Whether the cells below the element are the ones it was drawn over.
+  bool SameUnder(const Screen& screen) const {
+    const Box& region = state_->region;
+    for (int y = 0; y < state_->under.dimy(); ++y) {
+      for (int x = 0; x < state_->under.dimx(); ++x) {
+        const Cell& a = screen.CellAt(region.x_min + x, region.y_min + y);
+        const Cell& b = state_->under.CellAt(x, y);
+        if (a.character != b.character ||
+            a.foreground_color != b.foreground_color ||
+            a.background_color != b.background_color ||
+            a.blink != b.blink || a.bold != b.bold || a.dim != b.dim ||
+            a.italic != b.italic || a.inverted != b.inverted ||
+            a.underlined != b.underlined ||
+            a.underlined_double != b.underlined_double ||
+            a.strikethrough != b.strikethrough ||
+            a.automerge != b.automerge) {
+          return false;
+        }
+        if (a.hyperlink == 0 || b.hyperlink == 0) {
+          if (a.hyperlink != b.hyperlink) {
+            return false;
+          }
+        } else if (screen.Hyperlink(a.hyperlink) !=
+                   state_->hyperlinks[b.hyperlink - 1]) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  void Blit(Screen& screen) {
+    const Box& region = state_->region;
+    std::vector<uint16_t> links = {0};
+    for (const auto& hyperlink : state_->hyperlinks) {
+      links.push_back(screen.RegisterHyperlink(hyperlink));
+    }
+    for (int y = 0; y < state_->cells.dimy(); ++y) {
+      for (int x = 0; x < state_->cells.dimx(); ++x) {
+        Cell& cell = screen.CellAt(region.x_min + x, region.y_min + y);
+        cell = state_->cells.CellAt(x, y);
+        cell.hyperlink = links[cell.hyperlink];
+      }
+    }
+  }
+
+  std::shared_ptr<Memo::Internal> state_;
+  bool selected_ = false;
+};
+
+/// @brief Reuse the element built by |builder| from one frame to the next, as
+/// long as |deps| is unchanged. While the box it is assigned is unchanged too,
+/// its layout and its rendering are reused as well: the cells are copied from
+/// a cache.
+///
+/// |deps| must change whenever the element built would differ, e.g. it can be
+/// a version number, or a hash of the data displayed. The element must not
+/// depend on anything else, like the focus or an animation.
+///
+/// The element is drawn over the cells below, like any other. Its rendering is
+/// reused only while they are unchanged, e.g. while the background of its
+/// parent is the same.
+///
+/// @param key The cache, kept by the caller from one frame to the next.
+/// @param deps The dependencies of the element built.
+/// @param builder Build the element, when needed.
+/// @see ftxui::Memo
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Memo sidebar_memo;
+/// auto renderer = Renderer([&] {
+///   return hbox({
+///     memo(sidebar_memo, sidebar_version, [&] { return Sidebar(); }),
+///     separator(),
+///     Content() | flex,
+///   });
+/// });
+/// ```
+Element memo(Memo& key,
+             size_t deps,
+             const std::function<Element()>& builder) {
+  return MakeNode<MemoNode>(key, deps, builder);
+}
+
+}  // namespace ftxui
@@ -0,0 +1,202 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/dom/counted_test_helper.hpp"  // for Counted, Counters
+#include "ftxui/dom/elements.hpp"             // for text, memo, hbox, dbox, bgcolor
+#include "ftxui/dom/memo.hpp"                 // for Memo
+#include "ftxui/dom/node.hpp"                 // for Render
+#include "ftxui/screen/color.hpp"             // for Color
+#include "ftxui/screen/screen.hpp"            // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// The steps of an element, and how many times it is built.
+struct MemoCounters : Counters {
+  int build = 0;
+};
+
+Element Build(MemoCounters& counters, const std::string& label) {
+  counters.build++;
+  return Counted(text(label) | border, counters);
+}
+
+}  // namespace
+
+TEST(MemoTest, ReuseWhileUnchanged) {
+  Memo key;
+  MemoCounters counters;
+  std::string label = "static";
+  size_t version = 0;
+  auto document = [&] {
+    return hbox({
+        memo(key, version, [&] { return Build(counters, label); }),
+        text("dynamic"),
+    });
+  };
+
+  Screen screen(20, 3);
+  Render(screen, document());
+  const std::string expected = screen.ToString();
+  EXPECT_EQ(counters.build, 1);
+  EXPECT_EQ(counters.render, 1);
+
+  // The element isn't built, laid out nor rendered again.
+  const MemoCounters first = counters;
+  for (int i = 0; i < 3; ++i) {
+    screen.Clear();
+    Render(screen, document());
+    EXPECT_EQ(screen.ToString(), expected);
+  }
+  EXPECT_EQ(counters.build, first.build);
+  EXPECT_EQ(counters.compute_requirement, first.compute_requirement);
+  EXPECT_EQ(counters.set_box, first.set_box);
+  EXPECT_EQ(counters.render, first.render);
+
+  // A change of the dependencies builds it again.
+  label = "changed";
+  version++;
+  screen.Clear();
+  Render(screen, document());
+  EXPECT_EQ(counters.build, 2);
+  EXPECT_EQ(counters.render, 2);
+  EXPECT_EQ(screen.ToString(), [&] {
+    Screen reference(20, 3);
+    Render(reference, hbox({text("changed") | border, text("dynamic")}));
+    return reference.ToString();
+  }());
+
+  // So does Invalidate().
+  key.Invalidate();
+  Render(screen, document());
+  EXPECT_EQ(counters.build, 3);
+}
+
+// The element is laid out and rendered again when its box changes, without
+// being built again.
+TEST(MemoTest, BoxChanged) {
+  Memo key;
+  MemoCounters counters;
+  auto document = [&] {
+    return memo(key, 0, [&] { return Build(counters, "label"); }) | flex;
+  };
+
+  Screen small(10, 3);
+  Render(small, document());
+  Screen large(15, 3);
+  Render(large, document());
+  EXPECT_EQ(counters.build, 1);
+  EXPECT_EQ(counters.render, 2);
+
+  Screen reference(15, 3);
+  Render(reference, text("label") | border | flex);
+  EXPECT_EQ(large.ToString(), reference.ToString());
+}
+
+// The element is drawn over the cells below. Its rendering is only reused over
+// the same cells.
+TEST(MemoTest, DrawnOver) {
+  Memo key;
+  MemoCounters counters;
+  auto document = [&](const std::string& below) {
+    return dbox({
+        text(below),
+        memo(key, 0, [&] { return Build(counters, "memo"); }),
+    });
+  };
+  auto expected = [](const std::string& below) {
+    Screen reference(8, 3);
+    Render(reference, dbox({text(below), text("memo") | border}));
+    return reference.ToString();
+  };
+
+  for (int i = 0; i < 2; ++i) {
+    Screen screen(8, 3);
+    Render(screen, document("xxxxxxxx"));
+    EXPECT_EQ(screen.ToString(), expected("xxxxxxxx"));
+  }
+  EXPECT_EQ(counters.render, 1);
+
+  Screen screen(8, 3);
+  Render(screen, document("yyyyyyyy"));
+  EXPECT_EQ(screen.ToString(), expected("yyyyyyyy"));
+  EXPECT_EQ(counters.build, 1);
+  EXPECT_EQ(counters.render, 2);
+}
+
+// The background of the parent is kept below the element.
+TEST(MemoTest, ColoredParent) {
+  Memo key;
+  MemoCounters counters;
+  Color background = Color::Red;
+  auto document = [&] {
+    return hbox({
+               text("a"),
+               memo(key, 0, [&] { return Build(counters, "memo"); }),
+           }) |
+           bgcolor(background);
+  };
+
+  for (int i = 0; i < 2; ++i) {
+    Screen screen(7, 3);
+    Render(screen, document());
+    EXPECT_EQ(screen.CellAt(0, 1).background_color, Color(Color::Red));
+    EXPECT_EQ(screen.CellAt(1, 0).background_color, Color(Color::Red));
+    EXPECT_EQ(screen.CellAt(3, 1).background_color, Color(Color::Red));
+    EXPECT_EQ(screen.CellAt(6, 2).background_color, Color(Color::Red));
+  }
+  EXPECT_EQ(counters.render, 1);
+
+  background = Color::Blue;
+  Screen screen(7, 3);
+  Render(screen, document());
+  EXPECT_EQ(screen.CellAt(3, 1).background_color, Color(Color::Blue));
+  EXPECT_EQ(screen.CellAt(6, 2).background_color, Color(Color::Blue));
+  EXPECT_EQ(counters.render, 2);
+}
+
+// The hyperlinks are registered again into the screen the cells are copied to.
+TEST(MemoTest, Hyperlink) {
+  Memo key;
+  auto document = [&] {
+    return hbox({
+        text("a") | hyperlink("https://a.com"),
+        memo(key, 0, [] { return text("b") | hyperlink("https://b.com"); }),
+    });
+  };
+
+  Screen first(2, 1);
+  Render(first, document());
+  Screen second(2, 1);
+  second.RegisterHyperlink("https://other.com");
+  Render(second, document());
+  EXPECT_EQ(second.Hyperlink(second.CellAt(0, 0).hyperlink), "https://a.com");
+  EXPECT_EQ(second.Hyperlink(second.CellAt(1, 0).hyperlink), "https://b.com");
+  EXPECT_EQ(second.ToString(), first.ToString());
+}
+
+// The selection is drawn, and doesn't persist after it is cleared.
+TEST(MemoTest, Selection) {
+  Memo key;
+  MemoCounters counters;
+  auto document = [&] {
+    return memo(key, 0, [&] { return Build(counters, "label"); });
+  };
+
+  Screen screen(7, 3);
+  Render(screen, document());
+
+  Selection selection(1, 1, 3, 1);
+  Render(screen, document().get(), selection);
+  EXPECT_TRUE(screen.CellAt(2, 1).inverted);
+
+  screen.Clear();
+  Render(screen, document());
+  EXPECT_FALSE(screen.CellAt(2, 1).inverted);
+}
+
+}  // namespace ftxui
@@ -23,7 +23,7 @@ void Node::ComputeRequirement() {
     return;
   }
   for (auto& child : children_) {
-    child->ComputeRequirement();
+    child->ComputeRequirementIfNeeded();
   }
 
   // By default, the requirement is the one of the first child.
@@ -40,6 +40,7 @@ void Node::ComputeRequirement() {
 /// @brief Assign a position and a dimension to an element for drawing.
 void Node::SetBox(Box box) {
   box_ = box;
+  layout_resolved_ = false;
 }
 
 /// @brief Compute the selection of an element.
@@ -64,11 +65,48 @@ void Node::Render(Screen& screen) {
 
 void Node::Check(Status* status) {
   for (auto& child : children_) {
-    child->Check(status);
+    child->CheckIfNeeded(status);
   }
   status->need_iteration |= (status->iteration == 0);
 }
 
+/// @brief Same as ComputeRequirement(), unless the layout is already resolved.
+void Node::ComputeRequirementIfNeeded() {
+  if (!layout_resolved_) {
+    ComputeRequirement();
+  }
+}
+
+/// @brief Same as SetBox(), unless the layout is already resolved within the
+/// same box.
+void Node::SetBoxIfNeeded(Box box) {
+  if (layout_resolved_ && box == box_) {
+    return;
+  }
+  SetBox(box);
+}
+
+/// @brief Same as Check(), unless the layout is already resolved. Records
+/// whether this subtree requested another iteration.
+void Node::CheckIfNeeded(Status* status) {
+  // Every element is laid out at least once.
+  if (status->iteration == 0) {
+    layout_resolved_ = false;
+    Check(status);
+    return;
+  }
+
+  if (layout_resolved_) {
+    return;
+  }
+
+  const bool need_iteration = status->need_iteration;
+  status->need_iteration = false;
+  Check(status);
+  layout_resolved_ = !status->need_iteration;
+  status->need_iteration |= need_iteration;
+}
+
 std::string Node::GetSelectedContent(Selection& selection) {
   std::string content;
 
@@ -102,13 +140,7 @@ void Render(Screen& screen, Node* node) {
   Render(screen, node, selection);
 }
 
-void Render(Screen& screen, Node* node, Selection& selection) {
-  Box box;
-  box.x_min = 0;
-  box.y_min = 0;
-  box.x_max = screen.dimx() - 1;
-  box.y_max = screen.dimy() - 1;
-
+void LayoutNode(Node* node, Box box) {
   Node::Status status;
   node->Check(&status);
   const int max_iterations = 20;
@@ -124,6 +156,16 @@ void Render(Screen& screen, Node* node, Selection& selection) {
     status.iteration++;
     node->Check(&status);
   }
+}
+
+void Render(Screen& screen, Node* node, Selection& selection) {
+  Box box;
+  box.x_min = 0;
+  box.y_min = 0;
+  box.x_max = screen.dimx() - 1;
+  box.y_max = screen.dimy() - 1;
+
+  LayoutNode(node, box);
 
   // Step 3: Selection
   if (!selection.IsEmpty()) {
@@ -131,7 +173,7 @@ void Render(Screen& screen, Node* node, Selection& selection) {
   }
 
   bool use_cursor = node->requirement().focused.enabled;
-  if (!Terminal::GetQuirks().CursorHiding() &&
+  if (!Terminal::GetQuirksSnapshot().cursor_hiding &&
       node->requirement().focused.cursor_shape ==
           Screen::Cursor::Shape::Hidden) {
     // Setting the cursor to the right position allow folks using CJK (China,
@@ -0,0 +1,54 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+
+#include "ftxui/dom/counted_test_helper.hpp"  // for Counted, Counters
+#include "ftxui/dom/elements.hpp"             // for text, paragraph, vbox, hbox, border
+#include "ftxui/dom/node.hpp"                 // for Render
+#include "ftxui/screen/screen.hpp"            // for Screen
+
+namespace ftxui {
+
+// The paragraph requests additional iterations of the layout. The elements
+// above it, whose layout is resolved, aren't laid out again.
+TEST(NodeTest, IncrementalLayout) {
+  Counters counters;
+  auto document = vbox({
+      Counted(hbox({text("a"), text("b"), text("c")}) | border, counters),
+      paragraph("Lorem ipsum dolor sit amet"),
+  });
+
+  Screen screen(12, 6);
+  Render(screen, document);
+  EXPECT_EQ(screen.ToString(),
+            "╭──────────╮\r\n"
+            "│abc       │\r\n"
+            "╰──────────╯\r\n"
+            "Lorem ipsum \r\n"
+            "dolor sit   \r\n"
+            "amet        ");
+  EXPECT_EQ(counters.compute_requirement, 1);
+  EXPECT_EQ(counters.set_box, 1);
+}
+
+// A resolved element is laid out again when its box changes.
+TEST(NodeTest, IncrementalLayoutBoxChanged) {
+  Counters counters;
+  auto document = vbox({
+      paragraph("Lorem ipsum dolor sit amet"),
+      Counted(text("static"), counters),
+  });
+
+  Screen screen(12, 4);
+  Render(screen, document);
+  EXPECT_EQ(screen.ToString(),
+            "Lorem ipsum \r\n"
+            "dolor sit   \r\n"
+            "amet        \r\n"
+            "static      ");
+  EXPECT_EQ(counters.compute_requirement, 1);
+  EXPECT_GT(counters.set_box, 1);
+}
+
+}  // namespace ftxui
@@ -1,50 +1,384 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <functional>   // for function
-#include <sstream>      // for basic_istream, stringstream
-#include <string>       // for string, allocator, getline
+#include <algorithm>    // for max, min
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t, uint32_t
+#include <limits>       // for numeric_limits
+#include <string>       // for string
 #include <string_view>  // for string_view
-#include <utility>      // for move
+#include <utility>      // for move, pair
+#include <vector>       // for vector
 
-#include "ftxui/dom/elements.hpp"  // for flexbox, Element, text, Elements, operator|, xflex, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
-#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::JustifyContent, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::FlexEnd, FlexboxConfig::JustifyContent::SpaceBetween
+#include "ftxui/dom/elements.hpp"  // for Element, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
+#include "ftxui/dom/frame_arena.hpp"         // for MakeNode
+#include "ftxui/dom/node.hpp"                // for Node
+#include "ftxui/dom/paragraph_config.hpp"    // for ParagraphConfig, ParagraphConfig::Align, ParagraphConfig::Wrap
+#include "ftxui/dom/requirement.hpp"         // for Requirement
+#include "ftxui/dom/selection.hpp"           // for Selection
+#include "ftxui/screen/box.hpp"              // for Box
+#include "ftxui/screen/screen.hpp"           // for Screen
+#include "ftxui/screen/string.hpp"           // for string_width
+#include "ftxui/screen/string_internal.hpp"  // for EatCodePoint, IsCombining, IsControl, IsFullWidth
 
 namespace ftxui {
 
 namespace {
-Elements Split(std::string_view the_text) {
-  Elements output;
+
+// The width used before the paragraph is assigned a box: no line is broken.
+constexpr int kUnbounded = std::numeric_limits<int>::max();
+
+// Call |f(x, glyph)| for every glyph of |word| drawn from |x|. The combining
+// characters are put with the glyph they are modifying. Fullwidth glyphs are
+// followed by an empty one.
+template <typename F>
+void ForEachGlyph(std::string_view word, int x, F f) {
   size_t start = 0;
-  size_t end = the_text.find(' ');
-  while (end != std::string_view::npos) {
-    output.push_back(text(the_text.substr(start, end - start)));
-    start = end + 1;
-    end = the_text.find(' ', start);
+  while (start < word.size()) {
+    size_t end = 0;
+    uint32_t codepoint = 0;
+    if (!EatCodePoint(word, start, &end, &codepoint) || IsControl(codepoint) ||
+        IsCombining(codepoint)) {
+      start = end;
+      continue;
+    }
+
+    size_t glyph_end = end;
+    while (glyph_end < word.size()) {
+      size_t next = 0;
+      uint32_t combining = 0;
+      if (!EatCodePoint(word, glyph_end, &next, &combining) ||
+          !IsCombining(combining)) {
+        break;
+      }
+      glyph_end = next;
+    }
+
+    f(x++, word.substr(start, glyph_end - start));
+    if (IsFullWidth(codepoint)) {
+      f(x++, std::string_view());
+    }
+    start = glyph_end;
   }
-  output.push_back(text(the_text.substr(start)));
-  return output;
 }
 
-Element Split(std::string_view paragraph,
-              const std::function<Element(std::string_view)>& f) {
-  Elements output;
-  size_t start = 0;
-  size_t end = paragraph.find('\n');
-  while (end != std::string_view::npos) {
-    output.push_back(f(paragraph.substr(start, end - start)));
-    start = end + 1;
-    end = paragraph.find('\n', start);
+class Paragraph : public Node {
+ public:
+  Paragraph(std::string text, ParagraphConfig config)
+      : text_(std::move(text)), config_(config) {
+    // Split the text into words, separated by spaces, and into paragraphs,
+    // separated by line feeds.
+    size_t start = 0;
+    for (size_t i = 0; i <= text_.size(); ++i) {
+      if (i != text_.size() && text_[i] != ' ' && text_[i] != '\n') {
+        continue;
+      }
+      const std::string_view word =
+          std::string_view(text_).substr(start, i - start);
+      words_.push_back({uint32_t(start), uint32_t(word.size()),
+                        string_width(word)});
+      if (i == text_.size() || text_[i] == '\n') {
+        paragraphs_end_.push_back(words_.size());
+      }
+      start = i + 1;
+    }
   }
-  output.push_back(f(paragraph.substr(start)));
-  return vbox(std::move(output));
-}
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement{};
+    const std::vector<Line>& lines = Lines(width_);
+    for (const Line& line : lines) {
+      requirement_.min_x = std::max(requirement_.min_x, line.width);
+    }
+    requirement_.min_y = int(lines.size());
+    selection_rows_.clear();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    // Like flexbox, the width asked only decreases during a layout. This
+    // guarantees it converges.
+    const int previous = width_;
+    width_ = std::min(width_, box.x_max - box.x_min + 1);
+    need_iteration_ = (width_ != previous);
+  }
+
+  void Check(Status* status) override {
+    if (status->iteration == 0) {
+      width_ = kUnbounded;
+      need_iteration_ = true;
+    }
+    status->need_iteration |= need_iteration_;
+  }
+
+  void Select(Selection& selection) override {
+    const Box selection_box = Box::Intersection(selection.GetBox(), box_);
+    if (selection_box.IsEmpty()) {
+      return;
+    }
+
+    const std::vector<Line>& lines = Lines(box_.x_max - box_.x_min + 1);
+    const int first = selection_box.y_min - box_.y_min;
+    const int last =
+        std::min(selection_box.y_max - box_.y_min + 1, int(lines.size()));
+    if (first >= last) {
+      return;
+    }
+    selection_first_line_ = first;
+    selection_rows_.assign(last - first, {-1, -1});
+
+    for (int i = first; i < last; ++i) {
+      const int y = box_.y_min + i;
+      const Box row_box{box_.x_min, box_.x_max, y, y};
+      const Selection row_selection = selection.SaturateHorizontal(row_box);
+      const int sel_start = row_selection.GetBox().x_min;
+      const int sel_end = row_selection.GetBox().x_max;
+      selection_rows_[i - first] = {sel_start, sel_end};
+
+      std::string part;
+      ForEachWord(lines[i], [&](int x, std::string_view word) {
+        bool separated = part.empty();
+        ForEachGlyph(word, x, [&](int glyph_x, std::string_view glyph) {
+          if (glyph_x < sel_start || glyph_x > sel_end) {
+            return;
+          }
+          if (!separated) {
+            part += ' ';
+            separated = true;
+          }
+          part += glyph;
+        });
+      });
+      selection.AddPart(part, y, sel_start, sel_end);
+    }
+  }
+
+  void Render(Screen& screen) override {
+    const Box visible = Box::Intersection(screen.stencil, box_);
+    if (visible.IsEmpty()) {
+      return;
+    }
+
+    const std::vector<Line>& lines = Lines(box_.x_max - box_.x_min + 1);
+    const int last =
+        std::min(visible.y_max - box_.y_min + 1, int(lines.size()));
+    for (int i = visible.y_min - box_.y_min; i < last; ++i) {
+      const int y = box_.y_min + i;
+      std::pair<int, int> selected = {-1, -1};
+      const size_t selection_index = size_t(i - selection_first_line_);
+      if (selection_index < selection_rows_.size()) {
+        selected = selection_rows_[selection_index];
+      }
+
+      ForEachWord(lines[i], [&](int x, std::string_view word) {
+        ForEachGlyph(word, x, [&](int glyph_x, std::string_view glyph) {
+          if (glyph_x < visible.x_min || glyph_x > visible.x_max) {
+            return;
+          }
+          Cell& cell = screen.CellAt(glyph_x, y);
+          cell.character = glyph;
+          if (selected.first != -1 && glyph_x >= selected.first &&
+              glyph_x <= selected.second) {
+            screen.GetSelectionStyle()(cell);
+          }
+        });
+      });
+    }
+  }
+
+ private:
+  struct Word {
+    uint32_t offset;
+    uint32_t size;
+    int width;
+  };
+
+  // The words [first, last) drawn on a line.
+  struct Line {
+    size_t first;
+    size_t last;
+    int width;
+    bool paragraph_end;
+  };
+
+  // Call |f(x, word)| for every word of |line|, at the position it is drawn.
+  template <typename F>
+  void ForEachWord(const Line& line, F f) const {
+    const int box_width = box_.x_max - box_.x_min + 1;
+    const int words = int(line.last - line.first);
+    int remaining = std::max(0, box_width - line.width);
+    int x = box_.x_min;
+    switch (config_.align) {
+      case ParagraphConfig::Align::Left:
+        break;
+      case ParagraphConfig::Align::Right:
+        x += remaining;
+        break;
+      case ParagraphConfig::Align::Center:
+        x += remaining / 2;
+        break;
+      case ParagraphConfig::Align::Justify:
+        if (line.paragraph_end || words < 2) {
+          remaining = 0;
+        }
+        break;
+    }
+
+    for (int i = 0; i < words; ++i) {
+      const Word& word = words_[line.first + i];
+      int offset = 0;
+      if (config_.align == ParagraphConfig::Align::Justify && i != 0) {
+        // Spread the remaining space between the words, rounded like
+        // FlexboxConfig::JustifyContent::SpaceBetween.
+        offset = remaining;
+        for (int k = words - 1; k > i; --k) {
+          offset = offset * (k - 1) / k;
+        }
+      }
+      f(x + offset, std::string_view(text_).substr(word.offset, word.size));
+      x += word.width + 1;
+    }
+  }
+
+  // The lines of the paragraph, broken to fit |width|. They are cached for the
+  // last widths requested.
+  const std::vector<Line>& Lines(int width) {
+    for (const auto& [cached_width, lines] : lines_cache_) {
+      if (cached_width == width) {
+        return lines;
+      }
+    }
+    if (lines_cache_.size() == 4) {
+      lines_cache_.erase(lines_cache_.begin());
+    }
+    lines_cache_.emplace_back(width, BreakLines(width));
+    return lines_cache_.back().second;
+  }
+
+  std::vector<Line> BreakLines(int width) const {
+    std::vector<Line> lines;
+    size_t first = 0;
+    for (const size_t last : paragraphs_end_) {
+      if (width == kUnbounded ||
+          config_.wrap == ParagraphConfig::Wrap::Greedy) {
+        BreakGreedy(first, last, width, &lines);
+      } else {
+        BreakBalanced(first, last, width, &lines);
+      }
+      lines.back().paragraph_end = true;
+      first = last;
+    }
+    return lines;
+  }
+
+  // Put as many words as possible on every line.
+  void BreakGreedy(size_t first,
+                   size_t last,
+                   int width,
+                   std::vector<Line>* lines) const {
+    Line line{first, first, 0, false};
+    for (size_t i = first; i < last; ++i) {
+      const int word_width = words_[i].width;
+      if (line.last != line.first &&
+          int64_t(line.width) + 1 + word_width > width) {
+        lines->push_back(line);
+        line = {i, i, 0, false};
+      }
+      line.width += (line.last != line.first ? 1 : 0) + word_width;
+      line.last = i + 1;
+    }
+    lines->push_back(line);
+  }
+
+  // Minimize the sum of the squared empty space at the end of the lines, using
+  // dynamic programming over the position of the next break. The last line is
+  // free, and a word longer than |width| is put alone on its line.
+  void BreakBalanced(size_t first,
+                     size_t last,
+                     int width,
+                     std::vector<Line>* lines) const {
+    const size_t count = last - first;
+    std::vector<int64_t> cost(count + 1, 0);
+    std::vector<size_t> next(count + 1, count);
+    for (size_t i = count; i-- > 0;) {
+      cost[i] = std::numeric_limits<int64_t>::max();
+      int line_width = -1;
+      for (size_t j = i; j < count; ++j) {
+        line_width += 1 + words_[first + j].width;
+        if (line_width > width && j != i) {
+          break;
+        }
+        const int64_t space = std::max(0, width - line_width);
+        const int64_t line_cost =
+            (j + 1 == count ? 0 : space * space) + cost[j + 1];
+        if (line_cost < cost[i]) {
+          cost[i] = line_cost;
+          next[i] = j + 1;
+        }
+      }
+    }
+
+    size_t i = 0;
+    do {
+      Line line{first + i, first + next[i], -1, false};
+      for (size_t j = line.first; j < line.last; ++j) {
+        line.width += 1 + words_[j].width;
+      }
+      line.width = std::max(0, line.width);
+      lines->push_back(line);
+      i = next[i];
+    } while (i < count);
+  }
+
+  std::string text_;
+  ParagraphConfig config_;
+  std::vector<Word> words_;
+  std::vector<size_t> paragraphs_end_;  // The index of their last word + 1.
+  std::vector<std::pair<int, std::vector<Line>>> lines_cache_;
+
+  int width_ = kUnbounded;
+  bool need_iteration_ = true;
+
+  // Selection state for the lines [selection_first_line_,
+  // selection_first_line_ + selection_rows_.size()).
+  int selection_first_line_ = 0;
+  std::vector<std::pair<int, int>> selection_rows_;
+};
 
 }  // namespace
 
+/// @brief Set how the lines are aligned.
+ParagraphConfig& ParagraphConfig::Set(ParagraphConfig::Align a) {
+  this->align = a;
+  return *this;
+}
+
+/// @brief Set where the lines are broken.
+ParagraphConfig& ParagraphConfig::Set(ParagraphConfig::Wrap w) {
+  this->wrap = w;
+  return *this;
+}
+
+/// @brief Return an element drawing the paragraph on multiple lines, broken
+/// and aligned as configured.
+/// @ingroup dom
+/// @see ParagraphConfig.
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = paragraph(help_text,
+///                              ParagraphConfig()
+///                                  .Set(ParagraphConfig::Align::Justify)
+///                                  .Set(ParagraphConfig::Wrap::Balanced));
+/// ```
+Element paragraph(std::string_view the_text, ParagraphConfig config) {
+  return MakeNode<Paragraph>(std::string(the_text), config);
+}
+
 /// @brief Return an element drawing the paragraph on multiple lines.
 /// @ingroup dom
-/// @see flexbox.
+/// @see ParagraphConfig.
 Element paragraph(std::string_view the_text) {
   return paragraphAlignLeft(the_text);
 }
@@ -52,51 +386,37 @@ Element paragraph(std::string_view the_text) {
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the left.
 /// @ingroup dom
-/// @see flexbox.
+/// @see ParagraphConfig.
 Element paragraphAlignLeft(std::string_view the_text) {
-  return Split(the_text, [](std::string_view line) {
-    static const auto config = FlexboxConfig().SetGap(1, 0);
-    return flexbox(Split(line), config);
-  });
+  return paragraph(the_text,
+                   ParagraphConfig().Set(ParagraphConfig::Align::Left));
 };
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the right.
 /// @ingroup dom
-/// @see flexbox.
+/// @see ParagraphConfig.
 Element paragraphAlignRight(std::string_view the_text) {
-  return Split(the_text, [](std::string_view line) {
-    static const auto config = FlexboxConfig().SetGap(1, 0).Set(
-        FlexboxConfig::JustifyContent::FlexEnd);
-    return flexbox(Split(line), config);
-  });
+  return paragraph(the_text,
+                   ParagraphConfig().Set(ParagraphConfig::Align::Right));
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the center.
 /// @ingroup dom
-/// @see flexbox.
+/// @see ParagraphConfig.
 Element paragraphAlignCenter(std::string_view the_text) {
-  return Split(the_text, [](std::string_view line) {
-    static const auto config =
-        FlexboxConfig().SetGap(1, 0).Set(FlexboxConfig::JustifyContent::Center);
-    return flexbox(Split(line), config);
-  });
+  return paragraph(the_text,
+                   ParagraphConfig().Set(ParagraphConfig::Align::Center));
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned
 /// using a justified alignment.
-/// the center.
 /// @ingroup dom
-/// @see flexbox.
+/// @see ParagraphConfig.
 Element paragraphAlignJustify(std::string_view the_text) {
-  return Split(the_text, [](std::string_view line) {
-    static const auto config = FlexboxConfig().SetGap(1, 0).Set(
-        FlexboxConfig::JustifyContent::SpaceBetween);
-    Elements words = Split(line);
-    words.push_back(text("") | xflex);
-    return flexbox(std::move(words), config);
-  });
+  return paragraph(the_text,
+                   ParagraphConfig().Set(ParagraphConfig::Align::Justify));
 }
 
 }  // namespace ftxui
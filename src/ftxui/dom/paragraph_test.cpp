@@ -0,0 +1,145 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/dom/elements.hpp"          // for paragraph, flexbox, text, vbox, xflex, Element
+#include "ftxui/dom/flexbox_config.hpp"    // for FlexboxConfig
+#include "ftxui/dom/node.hpp"              // for Render
+#include "ftxui/dom/paragraph_config.hpp"  // for ParagraphConfig
+#include "ftxui/dom/selection.hpp"         // for Selection
+#include "ftxui/screen/screen.hpp"         // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// The paragraph, built using a flexbox of words per line.
+Element Reference(std::string_view the_text,
+                  FlexboxConfig::JustifyContent justify) {
+  Elements lines;
+  size_t start = 0;
+  while (true) {
+    const size_t end = the_text.find('\n', start);
+    const std::string_view line = the_text.substr(start, end - start);
+    Elements words;
+    size_t word_start = 0;
+    while (true) {
+      const size_t word_end = line.find(' ', word_start);
+      words.push_back(text(line.substr(word_start, word_end - word_start)));
+      if (word_end == std::string_view::npos) {
+        break;
+      }
+      word_start = word_end + 1;
+    }
+    if (justify == FlexboxConfig::JustifyContent::SpaceBetween) {
+      words.push_back(text("") | xflex);
+    }
+    lines.push_back(
+        flexbox(std::move(words), FlexboxConfig().SetGap(1, 0).Set(justify)));
+    if (end == std::string_view::npos) {
+      break;
+    }
+    start = end + 1;
+  }
+  return vbox(std::move(lines));
+}
+
+std::string Print(Element element, int width) {
+  Screen screen(width, 12);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(ParagraphTest, SameAsFlexbox) {
+  const std::string_view texts[] = {
+      "Lorem ipsum dolor sit amet, consectetur adipiscing elit.",
+      "a  b   c d",
+      "  leading and trailing  ",
+      "hello\n\nworld foo bar\nbaz",
+      "测试 abc 测试测试 x",
+      "supercalifragilistic is a long word",
+  };
+  for (const std::string_view t : texts) {
+    for (int width = 1; width <= 30; ++width) {
+      EXPECT_EQ(Print(paragraphAlignLeft(t), width),
+                Print(Reference(t, FlexboxConfig::JustifyContent::FlexStart),
+                      width))
+          << t << " " << width;
+      EXPECT_EQ(Print(paragraphAlignRight(t), width),
+                Print(Reference(t, FlexboxConfig::JustifyContent::FlexEnd),
+                      width))
+          << t << " " << width;
+      EXPECT_EQ(Print(paragraphAlignCenter(t), width),
+                Print(Reference(t, FlexboxConfig::JustifyContent::Center),
+                      width))
+          << t << " " << width;
+    }
+  }
+}
+
+TEST(ParagraphTest, Justify) {
+  const std::string_view t =
+      "Lorem ipsum dolor sit amet, consectetur adipiscing elit.";
+  EXPECT_EQ(Print(paragraphAlignJustify(t), 12).substr(0, 28),
+            "Lorem  ipsum\r\n"
+            "dolor    sit\r\n");
+  for (int width = 1; width <= 30; ++width) {
+    EXPECT_EQ(
+        Print(paragraphAlignJustify(t), width),
+        Print(Reference(t, FlexboxConfig::JustifyContent::SpaceBetween), width))
+        << width;
+  }
+}
+
+TEST(ParagraphTest, Balanced) {
+  const auto config = ParagraphConfig().Set(ParagraphConfig::Wrap::Balanced);
+  Screen screen(6, 3);
+  Render(screen, paragraph("aaa bb cc ddddd", config));
+  EXPECT_EQ(screen.ToString(),
+            "aaa   \r\n"
+            "bb cc \r\n"
+            "ddddd ");
+
+  Screen greedy(6, 3);
+  Render(greedy, paragraph("aaa bb cc ddddd"));
+  EXPECT_EQ(greedy.ToString(),
+            "aaa bb\r\n"
+            "cc    \r\n"
+            "ddddd ");
+}
+
+// The requirement is the one of the lines broken within the width assigned.
+TEST(ParagraphTest, Requirement) {
+  auto element = hbox({
+      paragraph("aaa bb cc ddddd"),
+      text("|"),
+  });
+  Screen screen(7, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "aaa bb|\r\n"
+            "cc     \r\n"
+            "ddddd  ");
+}
+
+TEST(ParagraphTest, Selection) {
+  auto element = paragraph("Lorem ipsum dolor sit");
+  Screen screen(12, 2);
+  Selection selection(2, 0, 3, 1);
+  Render(screen, element.get(), selection);
+  EXPECT_EQ(selection.GetParts(), "rem ipsum\ndolo");
+  EXPECT_TRUE(screen.CellAt(2, 0).inverted);
+  EXPECT_FALSE(screen.CellAt(1, 0).inverted);
+  EXPECT_TRUE(screen.CellAt(3, 1).inverted);
+  EXPECT_FALSE(screen.CellAt(4, 1).inverted);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -5,6 +5,7 @@
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"     // for Element, unpack, Decorator, reflect
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -27,7 +28,7 @@ class Reflect : public Node {
   void SetBox(Box box) final {
     reflected_box_ = box;
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
   }
 
   void Render(Screen& screen) final {
@@ -42,7 +43,7 @@ class Reflect : public Node {
 
 Decorator reflect(Box& box) {
   return [&](Element child) -> Element {
-    return std::make_shared<Reflect>(std::move(child), box);
+    return MakeNode<Reflect>(std::move(child), box);
   };
 }
 
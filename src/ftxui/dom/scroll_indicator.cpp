@@ -6,7 +6,8 @@
 #include <string>     // for string
 #include <utility>    // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, vscroll_indicator, hscroll_indicator
+#include "ftxui/dom/elements.hpp"        // for Element, vscroll_indicator, hscroll_indicator
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node.hpp"            // for Node, Elements
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/dom/requirement.hpp"     // for Requirement
@@ -29,9 +30,9 @@ Element vscroll_indicator(Element child) {
     }
 
     void SetBox(Box box) override {
-      box_ = box;
+      Node::SetBox(box);
       box.x_max--;
-      children_[0]->SetBox(box);
+      children_[0]->SetBoxIfNeeded(box);
     }
 
     void Render(Screen& screen) final {
@@ -67,7 +68,7 @@ Element vscroll_indicator(Element child) {
       }
     }
   };
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 /// @brief Display a horizontal scrollbar at the bottom.
@@ -84,9 +85,9 @@ Element hscroll_indicator(Element child) {
     }
 
     void SetBox(Box box) override {
-      box_ = box;
+      Node::SetBox(box);
       box.y_max--;
-      children_[0]->SetBox(box);
+      children_[0]->SetBoxIfNeeded(box);
     }
 
     void Render(Screen& screen) final {
@@ -123,7 +124,7 @@ Element hscroll_indicator(Element child) {
       }
     }
   };
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
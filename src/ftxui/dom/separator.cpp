@@ -7,8 +7,9 @@
 #include <string>   // for basic_string, string
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT, separator, DOUBLE, EMPTY, HEAVY, separatorCharacter, separatorDouble, separatorEmpty, separatorHSelector, separatorHeavy, separatorLight, separatorStyled, separatorVSelector
-#include "ftxui/dom/node.hpp"      // for Node
+#include "ftxui/dom/elements.hpp"     // for Element, BorderStyle, LIGHT, separator, DOUBLE, EMPTY, HEAVY, separatorCharacter, separatorDouble, separatorEmpty, separatorHSelector, separatorHeavy, separatorLight, separatorStyled, separatorVSelector
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
+#include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/cell.hpp"      // for Cell
@@ -134,7 +135,7 @@ class SeparatorWithCell : public SeparatorAuto {
 /// down
 /// ```
 Element separator() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeNode<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -172,7 +173,7 @@ Element separator() {
 /// down
 /// ```
 Element separatorStyled(BorderStyle style) {
-  return std::make_shared<SeparatorAuto>(style);
+  return MakeNode<SeparatorAuto>(style);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -209,7 +210,7 @@ Element separatorStyled(BorderStyle style) {
 /// down
 /// ```
 Element separatorLight() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeNode<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -246,7 +247,7 @@ Element separatorLight() {
 /// down
 /// ```
 Element separatorDashed() {
-  return std::make_shared<SeparatorAuto>(DASHED);
+  return MakeNode<SeparatorAuto>(DASHED);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -283,7 +284,7 @@ Element separatorDashed() {
 /// down
 /// ```
 Element separatorHeavy() {
-  return std::make_shared<SeparatorAuto>(HEAVY);
+  return MakeNode<SeparatorAuto>(HEAVY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -320,7 +321,7 @@ Element separatorHeavy() {
 /// down
 /// ```
 Element separatorDouble() {
-  return std::make_shared<SeparatorAuto>(DOUBLE);
+  return MakeNode<SeparatorAuto>(DOUBLE);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -357,7 +358,7 @@ Element separatorDouble() {
 /// down
 /// ```
 Element separatorEmpty() {
-  return std::make_shared<SeparatorAuto>(EMPTY);
+  return MakeNode<SeparatorAuto>(EMPTY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -395,7 +396,7 @@ Element separatorEmpty() {
 /// down
 /// ```
 Element separatorCharacter(std::string_view value) {
-  return std::make_shared<Separator>(std::string(value));
+  return MakeNode<Separator>(std::string(value));
 }
 
 /// @brief Draw a separator in between two element filled with a given pixel.
@@ -426,7 +427,7 @@ Element separatorCharacter(std::string_view value) {
 /// Down
 /// ```
 Element separator(Cell pixel) {
-  return std::make_shared<SeparatorWithCell>(std::move(pixel));
+  return MakeNode<SeparatorWithCell>(std::move(pixel));
 }
 
 /// @brief Draw a horizontal bar, with the area in between left/right colored
@@ -496,7 +497,7 @@ Element separatorHSelector(float left,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(left, right, unselected_color, selected_color);
+  return MakeNode<Impl>(left, right, unselected_color, selected_color);
 }
 
 /// @brief Draw an vertical bar, with the area in between up/downcolored
@@ -566,7 +567,7 @@ Element separatorVSelector(float up,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(up, down, unselected_color, selected_color);
+  return MakeNode<Impl>(up, down, unselected_color, selected_color);
 }
 
 }  // namespace ftxui
@@ -5,6 +5,7 @@
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, strikethrough
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
@@ -29,7 +30,7 @@ Element strikethrough(Element child) {
     }
   };
 
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
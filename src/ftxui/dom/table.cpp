@@ -3,13 +3,24 @@
 // the LICENSE file.
 #include "ftxui/dom/table.hpp"
 
-#include <algorithm>         // for max
+#include <algorithm>         // for max, min, upper_bound
+#include <cstdint>           // for int64_t
+#include <functional>        // for function
 #include <initializer_list>  // for initializer_list
-#include <memory>   // for allocator, shared_ptr, allocator_traits<>::value_type
+#include <map>               // for map
+#include <memory>  // for allocator, shared_ptr, make_shared, allocator_traits<>::value_type
+#include <string>   // for string
 #include <utility>  // for move, swap
 #include <vector>   // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, operator|, text, separatorCharacter, Elements, BorderStyle, Decorator, emptyElement, size, gridbox, EQUAL, flex, flex_shrink, HEIGHT, WIDTH
+#include "ftxui/dom/box_helper.hpp"   // for Element, Compute
+#include "ftxui/dom/elements.hpp"     // for Element, operator|, text, separatorCharacter, Elements, BorderStyle, Decorator, emptyElement, size, gridbox, EQUAL, flex, flex_shrink, HEIGHT, WIDTH
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
+#include "ftxui/dom/node.hpp"         // for Node, Node::Status, LayoutNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/selection.hpp"    // for Selection
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
 
 namespace ftxui {
 namespace {
@@ -41,8 +52,265 @@ void Order(int& a, int& b) {
   }
 }
 
+// Draw a line of the table, replacing the element.
+Decorator Line(const std::string& charset) {
+  return [charset](Element /* unused */) {
+    return separatorCharacter(charset) | automerge;
+  };
+}
+
+// Draw a corner of the table, replacing the element.
+Decorator Corner(const std::string& charset) {
+  return [charset](Element /* unused */) { return text(charset) | automerge; };
+}
+
+// Size the element at (x, y) according to its role in the grid.
+Element Finalize(Element element, int x, int y) {
+  // Line
+  if ((x + y) % 2 == 1) {
+    return std::move(element) | flex;
+  }
+
+  // Cells
+  if (IsCell(x, y)) {
+    return std::move(element) | flex_shrink;
+  }
+
+  // Corners
+  return std::move(element) | size(WIDTH, EQUAL, 0) | size(HEIGHT, EQUAL, 0);
+}
+
 }  // namespace
 
+// The state of a table whose cells are built on demand. The decorations are
+// recorded, and applied to every element when it is built. The size of the
+// rows and the columns is computed once, and kept until the table is
+// decorated again.
+struct Table::Large {
+  struct Operation {
+    int x_min;
+    int x_max;
+    int y_min;
+    int y_max;
+    std::function<bool(int x, int y)> filter;
+    Decorator decorator;
+    bool line;
+  };
+
+  class View;
+
+  // Build the element at (x, y) of the grid, with its decorations.
+  Element Build(int x, int y) const {
+    Element element = IsCell(x, y) ? cell(x / 2, y / 2) : nullptr;
+    if (!element) {
+      element = emptyElement();
+    }
+    for (const auto& operation : operations) {
+      if (x < operation.x_min || x > operation.x_max ||  //
+          y < operation.y_min || y > operation.y_max) {
+        continue;
+      }
+      if (!operation.filter || operation.filter(x, y)) {
+        element = operation.decorator(std::move(element));
+      }
+    }
+    return Finalize(std::move(element), x, y);
+  }
+
+  // Whether a horizontal line is drawn on the row |y|, located between two
+  // rows of cells. The corners have no height.
+  bool LineAt(int y) const {
+    for (const auto& operation : operations) {
+      if (!operation.line || y < operation.y_min || y > operation.y_max) {
+        continue;
+      }
+      for (int x = operation.x_min | 1; x <= operation.x_max; x += 2) {
+        if (!operation.filter || operation.filter(x, y)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // Compute the requirement of the columns and the position of the rows, from
+  // the rows sampled.
+  void Measure() {
+    if (measured) {
+      return;
+    }
+    measured = true;
+
+    box_helper::Element init;
+    init.min_size = 0;
+    init.flex_grow = 1024;    // NOLINT
+    init.flex_shrink = 1024;  // NOLINT
+    columns.assign(dim_x, init);
+
+    std::vector<int> height(dim_y, -1);
+    auto measure = [&](int y) {
+      if (height[y] != -1) {
+        return;
+      }
+      height[y] = 0;
+      for (int x = 0; x < dim_x; ++x) {
+        Element element = Build(x, y);
+        Node::Status status;
+        element->Check(&status);
+        element->ComputeRequirement();
+        const Requirement& requirement = element->requirement();
+        auto& column = columns[x];
+        column.min_size = std::max(column.min_size, requirement.min_x);
+        column.flex_grow = std::min(column.flex_grow, requirement.flex_grow_x);
+        column.flex_shrink =
+            std::min(column.flex_shrink, requirement.flex_shrink_x);
+        height[y] = std::max(height[y], requirement.min_y);
+      }
+    };
+
+    const int rows = dim_y / 2;
+    if (sampled_rows <= 0 || sampled_rows >= rows) {
+      for (int y = 0; y < dim_y; ++y) {
+        measure(y);
+      }
+    } else {
+      // Spread the samples evenly, from the first row to the last one.
+      for (int i = 0; i < sampled_rows; ++i) {
+        const int row = sampled_rows == 1
+                            ? 0
+                            : int(int64_t(i) * (rows - 1) / (sampled_rows - 1));
+        measure(2 * row);
+        measure(2 * row + 1);
+      }
+      measure(dim_y - 1);
+    }
+
+    // The rows not sampled get the height of the highest sampled row of cells,
+    // and the height of the line they hold.
+    int row_height = 0;
+    for (int y = 1; y < dim_y; y += 2) {
+      row_height = std::max(row_height, height[y]);
+    }
+    offsets_y.resize(dim_y + 1);
+    offsets_y[0] = 0;
+    for (int y = 0; y < dim_y; ++y) {
+      if (height[y] == -1) {
+        height[y] = (y % 2 == 1) ? row_height : (LineAt(y) ? 1 : 0);
+      }
+      offsets_y[y + 1] = offsets_y[y] + height[y];
+    }
+  }
+
+  std::function<Element(int column, int row)> cell;
+  std::vector<Operation> operations;
+  int dim_x = 0;
+  int dim_y = 0;
+  int sampled_rows = 0;
+
+  // Computed by Measure():
+  bool measured = false;
+  std::vector<box_helper::Element> columns;
+  std::vector<int> offsets_y;  // The position of every row, and the height.
+};
+
+// Display a large table. Only the rows intersecting the visible area are
+// built, laid out and drawn.
+class Table::Large::View : public Node {
+ public:
+  explicit View(std::shared_ptr<Large> large) : large_(std::move(large)) {}
+
+  void ComputeRequirement() override {
+    large_->Measure();
+    requirement_ = Requirement{};
+    for (const auto& column : large_->columns) {
+      requirement_.min_x += column.min_size;
+    }
+    requirement_.min_y = large_->offsets_y.back();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    std::vector<box_helper::Element> columns = large_->columns;
+    box_helper::Compute(&columns, box.x_max - box.x_min + 1);
+    offsets_x_.resize(columns.size() + 1);
+    offsets_x_[0] = 0;
+    for (size_t x = 0; x < columns.size(); ++x) {
+      offsets_x_[x + 1] = offsets_x_[x] + columns[x].size;
+    }
+    rows_.clear();
+  }
+
+  void Select(Selection& selection) override {
+    const Box box = Box::Intersection(selection.GetBox(), box_);
+    if (box.IsEmpty()) {
+      return;
+    }
+    for (int y = First(box); y <= Last(box); ++y) {
+      for (auto& element : Row(y)) {
+        element->Select(selection);
+      }
+    }
+  }
+
+  void Render(Screen& screen) override {
+    const Box box = Box::Intersection(screen.stencil, box_);
+    if (box.IsEmpty()) {
+      return;
+    }
+    for (int y = First(box); y <= Last(box); ++y) {
+      for (auto& element : Row(y)) {
+        element->Render(screen);
+      }
+    }
+  }
+
+ private:
+  // The rows intersecting |box|, contained in |box_|.
+  int First(const Box& box) const {
+    const auto& offsets = large_->offsets_y;
+    return int(std::upper_bound(offsets.begin(), offsets.end(),
+                                box.y_min - box_.y_min) -
+               offsets.begin()) -
+           1;
+  }
+  int Last(const Box& box) const {
+    const auto& offsets = large_->offsets_y;
+    return std::min(large_->dim_y - 1,
+                    int(std::upper_bound(offsets.begin(), offsets.end(),
+                                         box.y_max - box_.y_min) -
+                        offsets.begin()) -
+                        1);
+  }
+
+  // Build the elements of the row |y| and lay them out, unless it was already.
+  Elements& Row(int y) {
+    auto it = rows_.find(y);
+    if (it != rows_.end()) {
+      return it->second;
+    }
+    Elements& row = rows_[y];
+    Box box;
+    box.y_min = box_.y_min + large_->offsets_y[y];
+    box.y_max = box_.y_min + large_->offsets_y[y + 1] - 1;
+    if (box.y_max < box.y_min) {
+      return row;
+    }
+    row.reserve(large_->dim_x);
+    for (int x = 0; x < large_->dim_x; ++x) {
+      Element element = large_->Build(x, y);
+      box.x_min = box_.x_min + offsets_x_[x];
+      box.x_max = box_.x_min + offsets_x_[x + 1] - 1;
+      LayoutNode(element.get(), box);
+      row.push_back(std::move(element));
+    }
+    return row;
+  }
+
+  std::shared_ptr<Large> large_;
+  std::vector<int> offsets_x_;
+  std::map<int, Elements> rows_;  // The rows built since the last SetBox().
+};
+
 /// @brief Create an empty table.
 Table::Table() {
   Initialize({});
@@ -85,6 +353,47 @@ Table::Table(std::initializer_list<std::vector<std::string>> init) {
   Initialize(std::move(input));
 }
 
+/// @brief Create a large table, whose cells are built on demand by |cell|.
+///
+/// Only the rows intersecting the visible area are built. It is meant to be
+/// displayed inside a `frame` or a `yframe`. The rows get the height they
+/// require. The cells can't be focused themselves: use `focusPosition` to
+/// scroll the frame.
+///
+/// `Render()` doesn't consume this table. Keep it, and render it on every
+/// frame: the size of the columns and the rows is computed once, and kept until
+/// the table is decorated again.
+/// @param columns The number of columns.
+/// @param rows The number of rows.
+/// @param cell Build the cell of a given column and row.
+Table::Table(int columns,
+             int rows,
+             std::function<Element(int column, int row)> cell) {
+  input_dim_x_ = std::max(0, columns);
+  input_dim_y_ = std::max(0, rows);
+  dim_x_ = 2 * input_dim_x_ + 1;
+  dim_y_ = 2 * input_dim_y_ + 1;
+  large_ = std::make_shared<Large>();
+  large_->cell = std::move(cell);
+  large_->dim_x = dim_x_;
+  large_->dim_y = dim_y_;
+}
+
+/// @brief Compute the size of the columns from |count| rows spread evenly over
+/// the table, instead of all of them. The other rows get the height of the
+/// highest row sampled. The content wider than its column is clipped.
+///
+/// This applies only to the tables whose cells are built on demand. The
+/// decorators are expected not to change the height of the elements.
+/// @param count The number of rows to sample. Zero samples all of them.
+void Table::SampleRows(int count) {
+  if (!large_) {
+    return;
+  }
+  large_->sampled_rows = count;
+  large_->measured = false;
+}
+
 // private
 void Table::Initialize(std::vector<std::vector<Element>> input) {
   input_dim_y_ = static_cast<int>(input.size());
@@ -210,24 +519,13 @@ TableSelection Table::SelectAll() {
 /// @brief Render the table.
 /// @return The rendered table. This is an element you can draw.
 Element Table::Render() {
+  if (large_) {
+    return MakeNode<Large::View>(large_);
+  }
   for (int y = 0; y < dim_y_; ++y) {
     for (int x = 0; x < dim_x_; ++x) {
       auto& it = elements_[y][x];
-
-      // Line
-      if ((x + y) % 2 == 1) {
-        it = std::move(it) | flex;
-        continue;
-      }
-
-      // Cells
-      if ((x % 2) == 1 && (y % 2) == 1) {
-        it = std::move(it) | flex_shrink;
-        continue;
-      }
-
-      // Corners
-      it = std::move(it) | size(WIDTH, EQUAL, 0) | size(HEIGHT, EQUAL, 0);
+      it = Finalize(std::move(it), x, y);
     }
   }
   dim_x_ = 0;
@@ -235,17 +533,39 @@ Element Table::Render() {
   return gridbox(std::move(elements_));
 }
 
+// private
+// Apply |decorator| to the elements of the rectangle for which |filter| is
+// true, or all of them when it is empty. |line| tells the decorator replaces
+// the element by a line of the table.
+void Table::Apply(int x_min,
+                  int x_max,
+                  int y_min,
+                  int y_max,
+                  const std::function<bool(int x, int y)>& filter,
+                  const Decorator& decorator,
+                  bool line) {
+  if (large_) {
+    large_->operations.push_back(
+        {x_min, x_max, y_min, y_max, filter, decorator, line});
+    large_->measured = false;
+    return;
+  }
+  for (int y = y_min; y <= y_max; ++y) {
+    for (int x = x_min; x <= x_max; ++x) {
+      if (!filter || filter(x, y)) {
+        Element& e = elements_[y][x];
+        e = std::move(e) | decorator;
+      }
+    }
+  }
+}
+
 /// @brief Apply the `decorator` to the selection.
 /// This decorate both the cells, the lines and the corners.
 /// @param decorator The decorator to apply.
 // NOLINTNEXTLINE
 void TableSelection::Decorate(const Decorator& decorator) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      Element& e = table_->elements_[y][x];
-      e = std::move(e) | decorator;
-    }
-  }
+  table_->Apply(x_min_, x_max_, y_min_, y_max_, nullptr, decorator);
 }
 
 /// @brief Apply the `decorator` to the selection.
@@ -253,14 +573,9 @@ void TableSelection::Decorate(const Decorator& decorator) {
 /// This decorate only the cells.
 // NOLINTNEXTLINE
 void TableSelection::DecorateCells(const Decorator& decorator) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && x % 2 == 1) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  table_->Apply(
+      x_min_, x_max_, y_min_, y_max_,
+      [](int x, int y) { return y % 2 == 1 && x % 2 == 1; }, decorator);
 }
 
 /// @brief Apply the `decorator` to the selection.
@@ -272,14 +587,10 @@ void TableSelection::DecorateCells(const Decorator& decorator) {
 void TableSelection::DecorateAlternateColumn(const Decorator& decorator,
                                              int modulo,
                                              int shift) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && (x / 2) % modulo == shift) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  table_->Apply(
+      x_min_, x_max_, y_min_, y_max_,
+      [=](int x, int y) { return y % 2 == 1 && (x / 2) % modulo == shift; },
+      decorator);
 }
 
 /// @brief Apply the `decorator` to the selection.
@@ -291,14 +602,12 @@ void TableSelection::DecorateAlternateColumn(const Decorator& decorator,
 void TableSelection::DecorateAlternateRow(const Decorator& decorator,
                                           int modulo,
                                           int shift) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && (y / 2) % modulo == shift) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  table_->Apply(
+      x_min_, x_max_, y_min_ + 1, y_max_ - 1,
+      [=](int /* x */, int y) {
+        return y % 2 == 1 && (y / 2) % modulo == shift;
+      },
+      decorator);
 }
 
 /// @brief Apply the `decorator` to the selection.
@@ -310,14 +619,12 @@ void TableSelection::DecorateAlternateRow(const Decorator& decorator,
 void TableSelection::DecorateCellsAlternateColumn(const Decorator& decorator,
                                                   int modulo,
                                                   int shift) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && x % 2 == 1 && ((x / 2) % modulo == shift)) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  table_->Apply(
+      x_min_, x_max_, y_min_, y_max_,
+      [=](int x, int y) {
+        return y % 2 == 1 && x % 2 == 1 && ((x / 2) % modulo == shift);
+      },
+      decorator);
 }
 
 /// @brief Apply the `decorator` to the selection.
@@ -329,106 +636,69 @@ void TableSelection::DecorateCellsAlternateColumn(const Decorator& decorator,
 void TableSelection::DecorateCellsAlternateRow(const Decorator& decorator,
                                                int modulo,
                                                int shift) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && x % 2 == 1 && ((y / 2) % modulo == shift)) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  table_->Apply(
+      x_min_, x_max_, y_min_, y_max_,
+      [=](int x, int y) {
+        return y % 2 == 1 && x % 2 == 1 && ((y / 2) % modulo == shift);
+      },
+      decorator);
 }
 
 /// @brief Apply the `decorator` to the border of the selection.
 /// @param decorator The decorator to apply.
 void TableSelection::DecorateBorder(const Decorator& decorator) {
-  for (int x = x_min_; x <= x_max_; ++x) {
-    table_->elements_[y_min_][x] =
-        std::move(table_->elements_[y_min_][x]) | decorator;
-    table_->elements_[y_max_][x] =
-        std::move(table_->elements_[y_max_][x]) | decorator;
-  }
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    table_->elements_[y][x_min_] =
-        std::move(table_->elements_[y][x_min_]) | decorator;
-    table_->elements_[y][x_max_] =
-        std::move(table_->elements_[y][x_max_]) | decorator;
-  }
+  table_->Apply(x_min_, x_max_, y_min_, y_min_, nullptr, decorator);
+  table_->Apply(x_min_, x_max_, y_max_, y_max_, nullptr, decorator);
+  table_->Apply(x_min_, x_min_, y_min_ + 1, y_max_ - 1, nullptr, decorator);
+  table_->Apply(x_max_, x_max_, y_min_ + 1, y_max_ - 1, nullptr, decorator);
 }
 
 /// @brief Apply the `decorator` to the left border of the selection.
 /// @param decorator The decorator to apply.
 void TableSelection::DecorateBorderLeft(const Decorator& decorator) {
-  for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_min_] =
-        std::move(table_->elements_[y][x_min_]) | decorator;
-  }
+  table_->Apply(x_min_, x_min_, y_min_, y_max_, nullptr, decorator);
 }
 
 /// @brief Apply the `decorator` to the right border of the selection.
 /// @param decorator The decorator to apply.
 void TableSelection::DecorateBorderRight(const Decorator& decorator) {
-  for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_max_] =
-        std::move(table_->elements_[y][x_max_]) | decorator;
-  }
+  table_->Apply(x_max_, x_max_, y_min_, y_max_, nullptr, decorator);
 }
 
 /// @brief Apply the `decorator` to the top border of the selection.
 /// @param decorator The decorator to apply.
 void TableSelection::DecorateBorderTop(const Decorator& decorator) {
-  for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_min_][x] =
-        std::move(table_->elements_[y_min_][x]) | decorator;
-  }
+  table_->Apply(x_min_, x_max_, y_min_, y_min_, nullptr, decorator);
 }
 
 /// @brief Apply the `decorator` to the bottom border of the selection.
 /// @param decorator The decorator to apply.
 void TableSelection::DecorateBorderBottom(const Decorator& decorator) {
-  for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_max_][x] =
-        std::move(table_->elements_[y_max_][x]) | decorator;
-  }
+  table_->Apply(x_min_, x_max_, y_max_, y_max_, nullptr, decorator);
 }
 
 /// @brief Apply the `decorator` to the separators of the selection.
 /// @param decorator The decorator to apply.
 void TableSelection::DecorateSeparator(const Decorator& decorator) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
-      if (y % 2 == 0 || x % 2 == 0) {
-        table_->elements_[y][x] =
-            std::move(table_->elements_[y][x]) | decorator;
-      }
-    }
-  }
+  table_->Apply(
+      x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+      [](int x, int y) { return y % 2 == 0 || x % 2 == 0; }, decorator);
 }
 
 /// @brief Apply the `decorator` to the vertical separators of the selection.
 /// @param decorator The decorator to apply.
 void TableSelection::DecorateSeparatorVertical(const Decorator& decorator) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
-      if (x % 2 == 0) {
-        table_->elements_[y][x] =
-            std::move(table_->elements_[y][x]) | decorator;
-      }
-    }
-  }
+  table_->Apply(
+      x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+      [](int x, int /* y */) { return x % 2 == 0; }, decorator);
 }
 
 /// @brief Apply the `decorator` to the horizontal separators of the selection.
 /// @param decorator The decorator to apply.
 void TableSelection::DecorateSeparatorHorizontal(const Decorator& decorator) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
-      if (y % 2 == 0) {
-        table_->elements_[y][x] =
-            std::move(table_->elements_[y][x]) | decorator;
-      }
-    }
-  }
+  table_->Apply(
+      x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+      [](int /* x */, int y) { return y % 2 == 0; }, decorator);
 }
 
 /// @brief Apply a `border` around the selection.
@@ -439,18 +709,16 @@ void TableSelection::Border(BorderStyle border) {
   BorderTop(border);
   BorderBottom(border);
 
-  // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_min_] =
-      text(table_charset[border][0]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_max_] =
-      text(table_charset[border][1]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_min_] =
-      text(table_charset[border][2]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_max_] =
-      text(table_charset[border][3]) | automerge;
+  // NOLINTBEGIN
+  table_->Apply(x_min_, x_min_, y_min_, y_min_, nullptr,
+                Corner(table_charset[border][0]), true);
+  table_->Apply(x_max_, x_max_, y_min_, y_min_, nullptr,
+                Corner(table_charset[border][1]), true);
+  table_->Apply(x_min_, x_min_, y_max_, y_max_, nullptr,
+                Corner(table_charset[border][2]), true);
+  table_->Apply(x_max_, x_max_, y_max_, y_max_, nullptr,
+                Corner(table_charset[border][3]), true);
+  // NOLINTEND
 }
 
 /// @brief Apply a `border` around the selection.
@@ -464,17 +732,14 @@ void TableSelection::Border(BorderStyle border, const Decorator& decorator) {
 /// @brief Draw some separator lines in the selection.
 /// @param border The border style to apply.
 void TableSelection::Separator(BorderStyle border) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
-      if (y % 2 == 0 || x % 2 == 0) {
-        Element& e = table_->elements_[y][x];
-        e = (y % 2 == 1) ? separatorCharacter(table_charset[border][5]) |
-                               automerge  // NOLINT
-                         : separatorCharacter(table_charset[border][4]) |
-                               automerge;  // NOLINT
-      }
-    }
-  }
+  table_->Apply(
+      x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+      [](int x, int y) { return y % 2 == 1 && x % 2 == 0; },
+      Line(table_charset[border][5]), true);  // NOLINT
+  table_->Apply(
+      x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+      [](int /* x */, int y) { return y % 2 == 0; },
+      Line(table_charset[border][4]), true);  // NOLINT
 }
 
 /// @brief Draw some separator lines in the selection.
@@ -488,14 +753,10 @@ void TableSelection::Separator(BorderStyle border, const Decorator& decorator) {
 /// @brief Draw some vertical separator lines in the selection.
 /// @param border The border style to apply.
 void TableSelection::SeparatorVertical(BorderStyle border) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
-      if (x % 2 == 0) {
-        table_->elements_[y][x] =
-            separatorCharacter(table_charset[border][5]) | automerge;  // NOLINT
-      }
-    }
-  }
+  table_->Apply(
+      x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+      [](int x, int /* y */) { return x % 2 == 0; },
+      Line(table_charset[border][5]), true);  // NOLINT
 }
 
 /// @brief Draw some vertical separator lines in the selection.
@@ -510,14 +771,10 @@ void TableSelection::SeparatorVertical(BorderStyle border,
 /// @brief Draw some horizontal separator lines in the selection.
 /// @param border The border style to apply.
 void TableSelection::SeparatorHorizontal(BorderStyle border) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
-      if (y % 2 == 0) {
-        table_->elements_[y][x] =
-            separatorCharacter(table_charset[border][4]) | automerge;  // NOLINT
-      }
-    }
-  }
+  table_->Apply(
+      x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+      [](int /* x */, int y) { return y % 2 == 0; },
+      Line(table_charset[border][4]), true);  // NOLINT
 }
 
 /// @brief Draw some horizontal separator lines in the selection.
@@ -532,10 +789,8 @@ void TableSelection::SeparatorHorizontal(BorderStyle border,
 /// @brief Draw some separator lines to the left side of the selection.
 /// @param border The border style to apply.
 void TableSelection::BorderLeft(BorderStyle border) {
-  for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_min_] =
-        separatorCharacter(table_charset[border][5]) | automerge;  // NOLINT
-  }
+  table_->Apply(x_min_, x_min_, y_min_, y_max_, nullptr,
+                Line(table_charset[border][5]), true);  // NOLINT
 }
 
 /// @brief Draw some separator lines to the left side of the selection.
@@ -550,10 +805,8 @@ void TableSelection::BorderLeft(BorderStyle border,
 /// @brief Draw some separator lines to the right side of the selection.
 /// @param border The border style to apply.
 void TableSelection::BorderRight(BorderStyle border) {
-  for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_max_] =
-        separatorCharacter(table_charset[border][5]) | automerge;  // NOLINT
-  }
+  table_->Apply(x_max_, x_max_, y_min_, y_max_, nullptr,
+                Line(table_charset[border][5]), true);  // NOLINT
 }
 
 /// @brief Draw some separator lines to the right side of the selection.
@@ -568,10 +821,8 @@ void TableSelection::BorderRight(BorderStyle border,
 /// @brief Draw some separator lines to the top side of the selection.
 /// @param border The border style to apply.
 void TableSelection::BorderTop(BorderStyle border) {
-  for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_min_][x] =
-        separatorCharacter(table_charset[border][4]) | automerge;  // NOLINT
-  }
+  table_->Apply(x_min_, x_max_, y_min_, y_min_, nullptr,
+                Line(table_charset[border][4]), true);  // NOLINT
 }
 
 /// @brief Draw some separator lines to the top side of the selection.
@@ -585,10 +836,8 @@ void TableSelection::BorderTop(BorderStyle border, const Decorator& decorator) {
 /// @brief Draw some separator lines to the bottom side of the selection.
 /// @param border The border style to apply.
 void TableSelection::BorderBottom(BorderStyle border) {
-  for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_max_][x] =
-        separatorCharacter(table_charset[border][4]) | automerge;  // NOLINT
-  }
+  table_->Apply(x_min_, x_max_, y_max_, y_max_, nullptr,
+                Line(table_charset[border][4]), true);  // NOLINT
 }
 
 /// @brief Draw some separator lines to the bottom side of the selection.
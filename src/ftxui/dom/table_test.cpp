@@ -2,9 +2,13 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <gtest/gtest.h>
+#include <functional>  // for function
+#include <string>      // for string, to_string
+#include <vector>      // for vector
 
 #include "ftxui/dom/elements.hpp"  // for LIGHT, flex, center, EMPTY, DOUBLE
-#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/selection.hpp"  // for Selection
 #include "ftxui/dom/table.hpp"
 #include "ftxui/screen/screen.hpp"  // for Screen
 
@@ -758,5 +762,119 @@ TEST(TableTest, DecorateBorder) {
   table.SelectAll().Separator(LIGHT, color(Color::Red));
 }
 
+namespace {
+
+std::string Cell(int column, int row) {
+  return std::string(size_t((column * 7 + row * 3) % 4), 'x') +
+         std::to_string(row);
+}
+
+void DecorateLargeTest(Table& table) {
+  table.SelectAll().Border(LIGHT);
+  table.SelectAll().SeparatorVertical(DOUBLE);
+  table.SelectRow(0).BorderBottom(HEAVY);
+  table.SelectRows(3, 5).Border(ROUNDED, color(Color::Red));
+  table.SelectRows(1, -1).DecorateCellsAlternateRow(inverted);
+  table.SelectColumn(1).DecorateCells(bold);
+  table.SelectCell(2, 6).Separator(DASHED);
+}
+
+// The same table, built from strings.
+Element TableOfStrings(int columns, int rows) {
+  std::vector<std::vector<std::string>> data(rows);
+  for (int row = 0; row < rows; ++row) {
+    for (int column = 0; column < columns; ++column) {
+      data[row].push_back(Cell(column, row));
+    }
+  }
+  auto table = Table(data);
+  DecorateLargeTest(table);
+  return table.Render();
+}
+
+Element LargeTable(int columns, int rows) {
+  auto table = Table(columns, rows, [](int column, int row) {
+    return text(Cell(column, row));
+  });
+  DecorateLargeTest(table);
+  return table.Render();
+}
+
+std::string Print(Element element, int dimx, int dimy) {
+  Screen screen(dimx, dimy);
+  Render(screen, element);
+  std::string inverted;
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      inverted += screen.CellAt(x, y).inverted ? "x" : ".";
+    }
+  }
+  return screen.ToString() + inverted;
+}
+
+}  // namespace
+
+TEST(TableTest, LargeSameAsTable) {
+  EXPECT_EQ(Print(LargeTable(4, 12), 30, 30),
+            Print(TableOfStrings(4, 12), 30, 30));
+  for (int focused : {0, 5, 12, 29}) {
+    auto decorate = [&](Element table) {
+      return table | focusPosition(0, focused) | vscroll_indicator | yframe;
+    };
+    EXPECT_EQ(Print(decorate(LargeTable(4, 12)), 30, 7),
+              Print(decorate(TableOfStrings(4, 12)), 30, 7))
+        << focused;
+  }
+}
+
+TEST(TableTest, LargeOnlyVisibleRows) {
+  int built = 0;
+  auto table = Table(3, 100000, [&](int column, int row) {
+    built++;
+    return text(std::to_string(column) + ":" + std::to_string(row));
+  });
+  table.SampleRows(10);
+  table.SelectAll().Border(LIGHT);
+  table.SelectAll().SeparatorVertical(LIGHT);
+
+  // The widths are computed from 10 rows.
+  Screen screen(30, 4);
+  Render(screen, table.Render() | focusPosition(0, 50000) | yframe);
+  EXPECT_EQ(screen.ToString(),
+            "│0:49998│1:49998│2:49998│     \r\n"
+            "│0:49999│1:49999│2:49999│     \r\n"
+            "│0:50000│1:50000│2:50000│     \r\n"
+            "│0:50001│1:50001│2:50001│     ");
+  EXPECT_EQ(built, 3 * 10 + 3 * 4);
+
+  // The size of the columns and the rows is kept across frames.
+  built = 0;
+  Render(screen, table.Render() | focusPosition(0, 100) | yframe);
+  EXPECT_EQ(built, 3 * 4);
+
+  // Unless the table is decorated again.
+  built = 0;
+  table.SelectRow(0).BorderBottom(LIGHT);
+  Render(screen, table.Render() | focusPosition(0, 100) | yframe);
+  EXPECT_EQ(built, 3 * 10 + 3 * 4);
+}
+
+TEST(TableTest, LargeSelection) {
+  auto print = [](Element element) {
+    Screen screen(30, 10);
+    Selection selection(3, 2, 6, 5);
+    Render(screen, element.get(), selection);
+    std::string inverted;
+    for (int y = 0; y < screen.dimy(); ++y) {
+      for (int x = 0; x < screen.dimx(); ++x) {
+        inverted += screen.CellAt(x, y).inverted ? "x" : ".";
+      }
+    }
+    return screen.ToString() + inverted + selection.GetParts();
+  };
+  EXPECT_EQ(print(LargeTable(3, 8) | yframe),
+            print(TableOfStrings(3, 8) | yframe));
+}
+
 }  // namespace ftxui
 // NOLINTEND
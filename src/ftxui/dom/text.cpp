@@ -3,20 +3,23 @@
 // the LICENSE file.
 #include <algorithm>  // for min, max
 #include <cstddef>
+#include <cstdint>      // for uint8_t, uint16_t, uint32_t, UINT16_MAX
 #include <memory>       // for make_shared
 #include <string>       // for string, wstring
 #include <string_view>  // for string_view
 #include <utility>      // for move
 #include <vector>       // for vector
 
-#include "ftxui/dom/deprecated.hpp"   // for text, vtext
-#include "ftxui/dom/elements.hpp"     // for Element, text, vtext
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/dom/selection.hpp"    // for Selection
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Cell, Screen
-#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, to_string
+#include "ftxui/dom/deprecated.hpp"          // for text, vtext
+#include "ftxui/dom/elements.hpp"            // for Element, text, vtext
+#include "ftxui/dom/frame_arena.hpp"         // for MakeNode
+#include "ftxui/dom/node.hpp"                // for Node
+#include "ftxui/dom/requirement.hpp"         // for Requirement
+#include "ftxui/dom/selection.hpp"           // for Selection
+#include "ftxui/screen/box.hpp"              // for Box
+#include "ftxui/screen/screen.hpp"           // for Cell, Screen
+#include "ftxui/screen/string.hpp"           // for string_width, Utf8ToGlyphs, to_string
+#include "ftxui/screen/string_internal.hpp"  // for EatCodePoint, IsCombining, IsControl, IsFullWidth
 
 namespace ftxui {
 
@@ -25,27 +28,36 @@ using ftxui::Screen;
 
 class Text : public Node {
  public:
-  explicit Text(std::string_view text) : glyphs_(Utf8ToGlyphs(text)) {
+  explicit Text(std::string text) : text_(std::move(text)) {
+    lines_offsets_.push_back(0);
     int max_width = 0;
     int current_width = 0;
-    int lines_count = 1;
-    lines_offsets_.push_back(0);
 
-    for (size_t i = 0; i < glyphs_.size(); ++i) {
-      if (glyphs_[i] == "\n") {
+    size_t start = 0;
+    while (start < text_.size()) {
+      const char c = text_[start];
+      if (c == '\n') {
+        AddGlyph(start++, 1, 0);
         max_width = std::max(max_width, current_width);
         current_width = 0;
-        lines_count++;
-        lines_offsets_.push_back((int)i + 1);
-      } else {
+        lines_offsets_.push_back(int(GlyphCount()));
+        continue;
+      }
+
+      // Fast path: printable ASCII. A byte is a glyph taking one cell.
+      if (c >= 0x20 && c < 0x7f) {  // NOLINT
+        AddGlyph(start++, 1, 1);
         current_width++;
+        continue;
       }
+
+      start = EatGlyph(start, &current_width);
     }
     max_width = std::max(max_width, current_width);
-    lines_offsets_.push_back((int)glyphs_.size() + 1);
+    lines_offsets_.push_back(int(GlyphCount()) + 1);
 
     requirement_.min_x = max_width;
-    requirement_.min_y = lines_count;
+    requirement_.min_y = int(lines_offsets_.size()) - 1;
   }
 
   void ComputeRequirement() override {
@@ -87,9 +99,9 @@ class Text : public Node {
       const int end = lines_offsets_[i + 1] - 1;
       for (int j = start; j < end; ++j) {
         if (sel_start <= x && x <= sel_end) {
-          part += glyphs_[j];
+          part += GlyphAt(j);
         }
-        x++;
+        x += GlyphWidth(j);
       }
       selection.AddPart(std::move(part), y, sel_start, sel_end);
     }
@@ -108,30 +120,110 @@ class Text : public Node {
         visible_box.y_max - box_.y_min + 1, lines_offsets_.size() - 1);
 
     for (size_t line = first_line; line < last_line; ++line, ++y) {
-      int x = box_.x_min;
-
-      for (auto glyph = glyphs_.begin() + lines_offsets_[line];
-           glyph != glyphs_.end() && *glyph != "\n"; ++glyph, ++x) {
-        if (x > box_.x_max) {
-          break;
+      const std::pair<int, int>* selected = nullptr;
+      const size_t sel_index = line - selection_first_line_;
+      if (sel_index < selection_rows_.size() &&
+          selection_rows_[sel_index].first != -1) {
+        selected = &selection_rows_[sel_index];
+      }
+      auto draw = [&](int x, std::string_view glyph) {
+        auto& cell = screen.CellAt(x, y);
+        cell.character = glyph;
+        if (selected && x >= selected->first && x <= selected->second) {
+          screen.GetSelectionStyle()(cell);
         }
+      };
 
-        auto& cell = screen.CellAt(x, y);
-        cell.character = *glyph;
-
-        const size_t sel_index = line - selection_first_line_;
-        if (sel_index < selection_rows_.size()) {
-          const auto& [sel_start, sel_end] = selection_rows_[sel_index];
-          if (sel_start != -1 && x >= sel_start && x <= sel_end) {
-            screen.GetSelectionStyle()(cell);
-          }
+      int x = box_.x_min;
+      const int end = lines_offsets_[line + 1] - 1;
+      for (int i = lines_offsets_[line]; i < end && x <= box_.x_max; ++i) {
+        draw(x, GlyphAt(i));
+        // Fullwidth glyphs take two cells. The second is left empty.
+        const int width = GlyphWidth(i);
+        for (int k = 1; k < width && x + k <= box_.x_max; ++k) {
+          draw(x + k, "");
         }
+        x += width;
       }
     }
   }
 
  private:
-  std::vector<std::string> glyphs_;
+  // A glyph: |size| bytes of |text_| from |offset|, taking |width| cells. The
+  // line feeds take none.
+  struct Slice {
+    uint32_t offset;
+    uint16_t size;
+    uint8_t width;
+  };
+
+  size_t GlyphCount() const { return ascii_ ? ascii_count_ : slices_.size(); }
+  std::string_view GlyphAt(size_t i) const {
+    if (ascii_) {
+      return std::string_view(text_).substr(i, 1);
+    }
+    return std::string_view(text_).substr(slices_[i].offset, slices_[i].size);
+  }
+  int GlyphWidth(size_t i) const {
+    if (ascii_) {
+      return text_[i] == '\n' ? 0 : 1;
+    }
+    return slices_[i].width;
+  }
+
+  void AddGlyph(size_t offset, size_t size, int width) {
+    if (ascii_) {
+      ascii_count_++;
+      return;
+    }
+    slices_.push_back({uint32_t(offset), uint16_t(size), uint8_t(width)});
+  }
+
+  // Decode the code point at |start|, and add it to the glyphs. Returns where
+  // the next one starts.
+  size_t EatGlyph(size_t start, int* width) {
+    UseSlices();
+    size_t end = 0;
+    uint32_t codepoint = 0;
+    if (!EatCodePoint(text_, start, &end, &codepoint) ||
+        IsControl(codepoint)) {
+      return end;
+    }
+
+    // Combining characters are put with the glyph they are modifying.
+    const size_t size = end - start;
+    if (IsCombining(codepoint)) {
+      if (!slices_.empty() && slices_.back().width != 0 &&
+          slices_.back().size + size <= UINT16_MAX) {
+        slices_.back().size += uint16_t(size);
+      }
+      return end;
+    }
+
+    const int glyph_width = IsFullWidth(codepoint) ? 2 : 1;
+    AddGlyph(start, size, glyph_width);
+    *width += glyph_width;
+    return end;
+  }
+
+  // Leave the fast path: the glyphs are no longer the bytes of |text_|. They
+  // are described by |slices_| instead.
+  void UseSlices() {
+    if (!ascii_) {
+      return;
+    }
+    ascii_ = false;
+    slices_.reserve(text_.size());
+    for (size_t i = 0; i < ascii_count_; ++i) {
+      slices_.push_back({uint32_t(i), 1, uint8_t(text_[i] == '\n' ? 0 : 1)});
+    }
+  }
+
+  std::string text_;
+  // While |ascii_|, the first |ascii_count_| bytes of |text_| are the glyphs.
+  bool ascii_ = true;
+  size_t ascii_count_ = 0;
+  std::vector<Slice> slices_;
   std::vector<int> lines_offsets_;
   // Selection state for the line range [selection_first_line_,
   // selection_first_line_ + selection_rows_.size()).
@@ -216,7 +308,7 @@ class VText : public Node {
 /// Hello world!
 /// ```
 Element text(std::string_view text) {
-  return std::make_shared<Text>(std::string(text));
+  return MakeNode<Text>(std::string(text));
 }
 
 /// @brief Display a piece of unicode text.
@@ -265,7 +357,7 @@ Element text(std::wstring_view text) {
 /// !
 /// ```
 Element vtext(std::string_view text) {
-  return std::make_shared<VText>(text);
+  return MakeNode<VText>(text);
 }
 
 /// @brief Display a piece unicode text vertically.
@@ -4,10 +4,12 @@
 #include <gtest/gtest.h>
 #include <string>       // for allocator, string
 #include <string_view>  // for string_view
+#include <vector>       // for vector
 
 #include "ftxui/dom/elements.hpp"   // for text, operator|, border, Element
 #include "ftxui/dom/node.hpp"       // for Render
 #include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/string.hpp"  // for Utf8ToGlyphs
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -158,5 +160,37 @@ TEST(TextTest, NewlineMultiple) {
   EXPECT_EQ("a\r\nb\r\nc", screen.ToString());
 }
 
+// The glyphs are the ones of Utf8ToGlyphs, whether the text starts with ASCII
+// or not.
+TEST(TextTest, SameAsGlyphs) {
+  for (const std::string t : {
+           "hello",
+           "héllo",
+           "a\tb\x01c",
+           "abc测试def",
+           "测试abc",
+           "abc\xff\xfe" "def",
+           "ab̲c̅",
+       }) {
+    const std::vector<std::string> glyphs = Utf8ToGlyphs(t);
+    auto element = text(t);
+    Screen screen(int(glyphs.size()), 1);
+    Render(screen, element);
+    EXPECT_EQ(element->requirement().min_x, int(glyphs.size())) << t;
+    for (size_t x = 0; x < glyphs.size(); ++x) {
+      EXPECT_EQ(screen.CellAt(int(x), 0).character, glyphs[x]) << t;
+    }
+  }
+}
+
+TEST(TextTest, NewlineMixed) {
+  auto element = text("ab\n测试\nc");
+  Screen screen(4, 3);
+  Render(screen, element);
+  EXPECT_EQ("ab  \r\n测试\r\nc   ", screen.ToString());
+  EXPECT_EQ(element->requirement().min_x, 4);
+  EXPECT_EQ(element->requirement().min_y, 3);
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -5,6 +5,7 @@
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, underlined
+#include "ftxui/dom/frame_arena.hpp"     // for MakeNode
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
@@ -31,7 +32,7 @@ class Underlined : public NodeDecorator {
 /// @brief Underline the given element.
 /// @ingroup dom
 Element underlined(Element child) {
-  return std::make_shared<Underlined>(std::move(child));
+  return MakeNode<Underlined>(std::move(child));
 }
 
 }  // namespace ftxui
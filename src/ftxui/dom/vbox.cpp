@@ -9,6 +9,7 @@
 
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, vbox
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/dom/selection.hpp"    // for Selection
@@ -26,7 +27,7 @@ class VBox : public Node {
     requirement_ = Requirement{};
 
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->ComputeRequirementIfNeeded();
 
       // Propagate the focused requirement.
       if (requirement_.focused.Prefer(child->requirement().focused)) {
@@ -59,7 +60,7 @@ class VBox : public Node {
     for (size_t i = 0; i < children_.size(); ++i) {
       box.y_min = y;
       box.y_max = y + elements[i].size - 1;
-      children_[i]->SetBox(box);
+      children_[i]->SetBoxIfNeeded(box);
       y = box.y_max + 1;
     }
   }
@@ -94,7 +95,7 @@ class VBox : public Node {
 /// });
 /// ```
 Element vbox(Elements children) {
-  return std::make_shared<VBox>(std::move(children));
+  return MakeNode<VBox>(std::move(children));
 }
 
 }  // namespace ftxui
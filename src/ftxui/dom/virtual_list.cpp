@@ -0,0 +1,124 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>   // for max, min
+#include <cstdint>     // for int64_t
+#include <functional>  // for function
+#include <limits>      // for numeric_limits
+#include <map>         // for map
+#include <utility>     // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, virtualList
+#include "ftxui/dom/frame_arena.hpp"  // for MakeNode
+#include "ftxui/dom/node.hpp"         // for Node, LayoutNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/selection.hpp"    // for Selection
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+
+class VirtualList : public Node {
+ public:
+  VirtualList(int count,
+              int row_height,
+              std::function<Element(int)> generator)
+      : count_(std::max(0, count)),
+        row_height_(std::max(1, row_height)),
+        generator_(std::move(generator)) {}
+
+  void ComputeRequirement() override {
+    // Keep some room, so that the frames scrolling it don't overflow.
+    const int64_t height = int64_t(count_) * row_height_;
+    requirement_ = Requirement{};
+    requirement_.min_y = int(
+        std::min<int64_t>(height, std::numeric_limits<int>::max() / 4));
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    rows_.clear();
+  }
+
+  void Select(Selection& selection) override {
+    const Box box = Box::Intersection(selection.GetBox(), box_);
+    if (box.IsEmpty()) {
+      return;
+    }
+    for (int i = First(box); i <= Last(box); ++i) {
+      Row(i)->Select(selection);
+    }
+  }
+
+  void Render(Screen& screen) override {
+    const Box box = Box::Intersection(screen.stencil, box_);
+    if (box.IsEmpty()) {
+      return;
+    }
+    for (int i = First(box); i <= Last(box); ++i) {
+      Row(i)->Render(screen);
+    }
+  }
+
+ private:
+  // The rows intersecting |box|, contained in |box_|.
+  int First(const Box& box) const {
+    return (box.y_min - box_.y_min) / row_height_;
+  }
+  int Last(const Box& box) const {
+    return std::min(count_ - 1, (box.y_max - box_.y_min) / row_height_);
+  }
+
+  // Build the row |index| and lay it out, unless it was already.
+  Node* Row(int index) {
+    Element& row = rows_[index];
+    if (row) {
+      return row.get();
+    }
+    row = generator_(index);
+
+    Box box = box_;
+    box.y_min = box_.y_min + index * row_height_;
+    box.y_max = std::min(box_.y_max, box.y_min + row_height_ - 1);
+
+    LayoutNode(row.get(), box);
+    return row.get();
+  }
+
+  int count_;
+  int row_height_;
+  std::function<Element(int)> generator_;
+  std::map<int, Element> rows_;  // The rows built since the last SetBox().
+};
+
+}  // namespace
+
+/// @brief A list of |count| rows of |row_height| lines, built on demand by
+/// |generator|. Only the rows intersecting the visible area are built, laid
+/// out and drawn. The cost doesn't depend on the number of rows.
+///
+/// It is meant to be displayed inside a `frame` or a `yframe`. The rows get the
+/// width of the list. They can't be focused themselves: use `focusPosition` to
+/// scroll the frame to a given row.
+///
+/// @param count The number of rows.
+/// @param row_height The height of every row.
+/// @param generator Build the row of a given index.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// auto element = virtualList(lines.size(), 1,
+///                            [&](int i) { return text(lines[i]); }) |
+///                focusPosition(0, selected) | vscroll_indicator | yframe;
+/// ```
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> generator) {
+  return MakeNode<VirtualList>(count, row_height, std::move(generator));
+}
+
+}  // namespace ftxui
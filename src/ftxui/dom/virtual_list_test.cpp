@@ -0,0 +1,95 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>   // for string, to_string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"  // for virtualList, text, vbox, frame, vscroll_indicator, focusPosition
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/selection.hpp"  // for Selection
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Element Row(int index) {
+  return vbox({
+      text("row " + std::to_string(index)),
+      text("  " + std::to_string(index * index)),
+  });
+}
+
+// The same list, built entirely.
+Element FullList(int count) {
+  Elements rows;
+  for (int i = 0; i < count; ++i) {
+    rows.push_back(Row(i));
+  }
+  return vbox(std::move(rows));
+}
+
+std::string Print(Element element, int dimx, int dimy) {
+  Screen screen(dimx, dimy);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(VirtualListTest, OnlyVisibleRows) {
+  int built = 0;
+  auto list = virtualList(1000000, 1, [&](int i) {
+    built++;
+    return text(std::to_string(i));
+  });
+  Screen screen(8, 5);
+  Render(screen, list | focusPosition(0, 500000) | yframe);
+  EXPECT_EQ(screen.ToString(),
+            "499998  \r\n"
+            "499999  \r\n"
+            "500000  \r\n"
+            "500001  \r\n"
+            "500002  ");
+  EXPECT_EQ(built, 5);
+}
+
+TEST(VirtualListTest, SameAsFullList) {
+  for (int focused : {0, 7, 40, 99}) {
+    auto decorate = [&](Element list) {
+      return list | focusPosition(0, focused * 2) | vscroll_indicator | frame |
+             border;
+    };
+    EXPECT_EQ(Print(decorate(virtualList(50, 2, Row)), 12, 9),
+              Print(decorate(FullList(50)), 12, 9));
+  }
+}
+
+TEST(VirtualListTest, Empty) {
+  EXPECT_EQ(Print(virtualList(0, 1, Row) | frame | border, 4, 3),
+            "╭──╮\r\n"
+            "│  │\r\n"
+            "╰──╯");
+}
+
+TEST(VirtualListTest, Selection) {
+  auto print = [](Element element) {
+    Screen screen(10, 6);
+    Selection selection(2, 1, 4, 3);
+    Render(screen, element.get(), selection);
+    std::string inverted;
+    for (int y = 0; y < screen.dimy(); ++y) {
+      for (int x = 0; x < screen.dimx(); ++x) {
+        inverted += screen.CellAt(x, y).inverted ? "x" : ".";
+      }
+    }
+    return screen.ToString() + inverted;
+  };
+  EXPECT_EQ(print(virtualList(20, 2, Row) | yframe),
+            print(FullList(20) | yframe));
+}
+
+}  // namespace ftxui
+// NOLINTEND
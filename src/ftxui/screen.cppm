@@ -8,7 +8,9 @@ module;
 #include <ftxui/screen/color.hpp>
 #include <ftxui/screen/color_info.hpp>
 #include <ftxui/screen/deprecated.hpp>
+#include <ftxui/screen/glyph.hpp>
 #include <ftxui/screen/image.hpp>
+#include <ftxui/screen/output_sink.hpp>
 #include <ftxui/screen/pixel.hpp>
 #include <ftxui/screen/screen.hpp>
 #include <ftxui/screen/string.hpp>
@@ -27,7 +29,9 @@ export namespace ftxui {
     using ftxui::Color;
     using ftxui::ColorInfo;
     using ftxui::Dimensions;
+    using ftxui::Glyph;
     using ftxui::Image;
+    using ftxui::OutputSink;
     using ftxui::Pixel;
     using ftxui::Screen;
     using ftxui::Surface;
@@ -64,6 +68,8 @@ export namespace ftxui {
         using ftxui::Terminal::Quirks;
         using ftxui::Terminal::GetQuirks;
         using ftxui::Terminal::SetQuirks;
+        using ftxui::Terminal::QuirksSnapshot;
+        using ftxui::Terminal::GetQuirksSnapshot;
     }
 
     /**
@@ -3,14 +3,16 @@
 // the LICENSE file.
 #include "ftxui/screen/color.hpp"
 
-#include <array>  // for array
+#include <array>    // for array
 #include <cmath>
 #include <cstdint>
-#include <cstdio>  // for snprintf
+#include <cstdio>   // for snprintf
+#include <cstring>  // for memcpy
 #include <string>
-#include <tuple>
+#include <string_view>  // for string_view
 
-#include "ftxui/screen/color_info.hpp"  // for GetColorInfo, ColorInfo
+#include "ftxui/screen/color_info.hpp"   // for GetColorInfo, ColorInfo
+#include "ftxui/screen/output_sink.hpp"  // for OutputSink
 #include "ftxui/screen/terminal.hpp"  // for ColorSupport, Color, Palette256, TrueColor
 
 namespace ftxui {
@@ -34,7 +36,8 @@ const std::array<const char*, 32> palette16code = {
     "97", "107",  //
 };
 
-void AppendNumber(std::string& out, uint8_t n) {
+template <typename Output>
+void AppendNumber(Output& out, uint8_t n) {
   if (n >= 100) {
     out += static_cast<char>('0' + n / 100);
     n %= 100;
@@ -50,6 +53,148 @@ void AppendNumber(std::string& out, uint8_t n) {
   }
 }
 
+// The 240 last colors of the 256 palette are a 6x6x6 cube and 24 greys. Since
+// the cube is separable, its nearest color is found independently for each
+// channel. The nearest grey only depends on the sum of the channels. Both are
+// tabulated once, at compile time, so that quantizing a RGB color is a few
+// lookups instead of a search over the whole palette.
+constexpr std::array<int, 6> kCubeLevels = {0, 95, 135, 175, 215, 255};
+constexpr int kCubeBegin = 16;
+constexpr int kGreyBegin = 232;
+constexpr int kGreyCount = 24;
+
+constexpr int GreyLevel(int index) {
+  return 8 + 10 * index;
+}
+
+constexpr std::array<uint8_t, 256> BuildCubeTable() {
+  std::array<uint8_t, 256> table = {};
+  for (int value = 0; value < 256; ++value) {
+    int best = 0;
+    for (int i = 1; i < 6; ++i) {
+      const int d = kCubeLevels[i] - value;        // NOLINT
+      const int d_best = kCubeLevels[best] - value;  // NOLINT
+      if (d * d < d_best * d_best) {
+        best = i;
+      }
+    }
+    table[value] = static_cast<uint8_t>(best);  // NOLINT
+  }
+  return table;
+}
+
+// Indexed by r + g + b. The distance to the grey g is:
+//   r^2 + g^2 + b^2 - 2 * g * (r + g + b) + 3 * g^2
+constexpr std::array<uint8_t, 3 * 255 + 1> BuildGreyTable() {
+  std::array<uint8_t, 3 * 255 + 1> table = {};
+  for (int sum = 0; sum <= 3 * 255; ++sum) {
+    int best = 0;
+    int best_cost = 0;
+    for (int i = 0; i < kGreyCount; ++i) {
+      const int level = GreyLevel(i);
+      const int cost = 3 * level * level - 2 * level * sum;
+      if (i == 0 || cost < best_cost) {
+        best = i;
+        best_cost = cost;
+      }
+    }
+    table[sum] = static_cast<uint8_t>(best);  // NOLINT
+  }
+  return table;
+}
+
+constexpr std::array<uint8_t, 256> kCubeTable = BuildCubeTable();
+constexpr std::array<uint8_t, 3 * 255 + 1> kGreyTable = BuildGreyTable();
+
+constexpr int Square(int x) {
+  return x * x;
+}
+
+// Returns the index of the closest color among the colors [16, 256) of the 256
+// palette. Ties are resolved toward the lowest index.
+uint8_t NearestPalette256(uint8_t red, uint8_t green, uint8_t blue) {
+  const int r = kCubeTable[red];
+  const int g = kCubeTable[green];
+  const int b = kCubeTable[blue];
+  const int cube_distance = Square(kCubeLevels[r] - red) +    // NOLINT
+                            Square(kCubeLevels[g] - green) +  // NOLINT
+                            Square(kCubeLevels[b] - blue);    // NOLINT
+
+  const int grey = kGreyTable[red + green + blue];
+  const int level = GreyLevel(grey);
+  const int grey_distance =
+      Square(level - red) + Square(level - green) + Square(level - blue);
+
+  if (grey_distance < cube_distance) {
+    return static_cast<uint8_t>(kGreyBegin + grey);
+  }
+  return static_cast<uint8_t>(kCubeBegin + 36 * r + 6 * g + b);
+}
+
+// Gamma correction:
+// https://en.wikipedia.org/wiki/Gamma_correction
+// Colors are interpolated in linear space. The conversion of the 256 possible
+// channel values is tabulated once.
+constexpr float kGamma = 2.2F;
+
+const std::array<float, 256>& LinearTable() {
+  static const std::array<float, 256> table = [] {
+    std::array<float, 256> out = {};
+    for (size_t i = 0; i < out.size(); ++i) {
+      // NOLINTNEXTLINE
+      out[i] = static_cast<float>(std::pow(double(i), double(kGamma)));
+    }
+    return out;
+  }();
+  return table;
+}
+
+// The inverse conversion truncates std::pow(value, 1 / gamma). Since it is
+// increasing, the smallest value producing each channel value is tabulated,
+// and the conversion is a binary search in this table.
+const std::array<float, 256>& FromLinearTable() {
+  static const std::array<float, 256> table = [] {
+    auto from_linear = [](float value) {
+      return std::pow(value, 1.F / kGamma);
+    };
+    // Positive floats are ordered like their bit patterns.
+    auto to_float = [](uint32_t bits) {
+      float value = 0.F;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    };
+    std::array<float, 256> out = {};
+    for (size_t i = 1; i < out.size(); ++i) {
+      uint32_t low = 0;
+      uint32_t high = 0;
+      const float max = 1e6F;  // Larger than 256^gamma.
+      std::memcpy(&high, &max, sizeof(high));
+      while (low < high) {
+        const uint32_t middle = low + (high - low) / 2;
+        if (from_linear(to_float(middle)) >= float(i)) {
+          high = middle;
+        } else {
+          low = middle + 1;
+        }
+      }
+      out[i] = to_float(low);  // NOLINT
+    }
+    return out;
+  }();
+  return table;
+}
+
+uint8_t FromLinear(float value) {
+  const auto& table = FromLinearTable();
+  size_t index = 0;
+  for (size_t step = 128; step != 0; step /= 2) {
+    if (table[index + step] <= value) {  // NOLINT
+      index += step;
+    }
+  }
+  return static_cast<uint8_t>(index);
+}
+
 }  // namespace
 
 bool Color::operator==(const Color& rhs) const {
@@ -71,19 +216,31 @@ std::string Color::Print(bool is_background_color) const {
 /// @param out The string to append to.
 /// @param is_background_color Whether this is a background color code.
 void Color::PrintTo(std::string& out, bool is_background_color) const {
+  PrintToInternal(out, is_background_color);
+}
+
+/// @brief Append the ANSI color code to an OutputSink.
+/// @param out The sink to append to.
+/// @param is_background_color Whether this is a background color code.
+void Color::PrintTo(OutputSink& out, bool is_background_color) const {
+  PrintToInternal(out, is_background_color);
+}
+
+template <typename Output>
+void Color::PrintToInternal(Output& out, bool is_background_color) const {
   switch (type_) {
     case ColorType::Palette1:
-      out.append(is_background_color ? "49" : "39", 2);
+      out += std::string_view(is_background_color ? "49" : "39", 2);
       return;
     case ColorType::Palette16:
-      out.append(palette16code[2 * red_ + (is_background_color ? 1 : 0)]);
+      out += palette16code[2 * red_ + (is_background_color ? 1 : 0)];
       return;
     case ColorType::Palette256:
-      out.append(is_background_color ? "48;5;" : "38;5;", 5);
+      out += std::string_view(is_background_color ? "48;5;" : "38;5;", 5);
       AppendNumber(out, red_);
       return;
     case ColorType::TrueColor:
-      out.append(is_background_color ? "48;2;" : "38;2;", 5);
+      out += std::string_view(is_background_color ? "48;2;" : "38;2;", 5);
       AppendNumber(out, red_);
       out += ';';
       AppendNumber(out, green_);
@@ -110,10 +267,11 @@ Color::Color(Palette16 index)
 /// @brief Build a color using Palette256 colors.
 Color::Color(Palette256 index)
     : type_(ColorType::Palette256), red_(index), alpha_(255) {
-  if (Terminal::ColorSupport() >= Terminal::Color::Palette256) {
+  const Terminal::Color support = Terminal::ColorSupport();
+  if (support >= Terminal::Color::Palette256) {
     return;
   }
-  if (Terminal::ColorSupport() == Terminal::Color::Palette1) {
+  if (support == Terminal::Color::Palette1) {
     type_ = ColorType::Palette1;
     return;
   }
@@ -134,33 +292,17 @@ Color::Color(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
       green_(green),
       blue_(blue),
       alpha_(alpha) {
-  if (Terminal::ColorSupport() == Terminal::Color::TrueColor) {
+  const Terminal::Color support = Terminal::ColorSupport();
+  if (support == Terminal::Color::TrueColor) {
     return;
   }
-  if (Terminal::ColorSupport() == Terminal::Color::Palette1) {
+  if (support == Terminal::Color::Palette1) {
     type_ = ColorType::Palette1;
     return;
   }
 
-  // Find the closest Color from the database:
-  const int max_distance = 256 * 256 * 3;
-  int closest = max_distance;
-  int best = 0;
-  const int database_begin = 16;
-  const int database_end = 256;
-  for (int i = database_begin; i < database_end; ++i) {
-    const ColorInfo color_info = GetColorInfo(Color::Palette256(i));
-    const int dr = color_info.red - red;
-    const int dg = color_info.green - green;
-    const int db = color_info.blue - blue;
-    const int dist = dr * dr + dg * dg + db * db;
-    if (closest > dist) {
-      closest = dist;
-      best = i;
-    }
-  }
-
-  if (Terminal::ColorSupport() == Terminal::Color::Palette256) {
+  const uint8_t best = NearestPalette256(red, green, blue);
+  if (support == Terminal::Color::Palette256) {
     type_ = ColorType::Palette256;
     red_ = best;
   } else {
@@ -233,59 +375,138 @@ Color Color::HSV(uint8_t h, uint8_t s, uint8_t v) {
 
 // static
 Color Color::Interpolate(float t, const Color& a, const Color& b) {
+  Color out;
+  Interpolate(&t, a, b, &out, 1);
+  return out;
+}
+
+/// @brief Interpolate between two colors, for a whole row of parameters.
+/// This is equivalent to, but faster than, calling Interpolate for each `t[i]`.
+/// @param t The interpolation parameters, in [0,1].
+/// @param a The color for t = 0.
+/// @param b The color for t = 1.
+/// @param out The interpolated colors. It must have room for `size` colors.
+/// @param size The number of parameters.
+// static
+void Color::Interpolate(const float* t,
+                        const Color& a,
+                        const Color& b,
+                        Color* out,
+                        size_t size) {
   if (a.type_ == ColorType::Palette1 ||  //
       b.type_ == ColorType::Palette1) {
-    if (t < 0.5F) {  // NOLINT
-      return a;
-    } else {
-      return b;
+    for (size_t i = 0; i < size; ++i) {
+      out[i] = t[i] < 0.5F ? a : b;  // NOLINT
     }
+    return;
   }
 
-  auto to_rgb =
-      [](const Color& color) -> std::tuple<uint8_t, uint8_t, uint8_t> {
-    switch (color.type_) {
-      case ColorType::Palette1: {
-        return {0, 0, 0};
-      }
-      case ColorType::Palette16: {
-        const ColorInfo info = GetColorInfo(Color::Palette16(color.red_));
-        return {info.red, info.green, info.blue};
-      }
-      case ColorType::Palette256: {
-        const ColorInfo info = GetColorInfo(Color::Palette256(color.red_));
-        return {info.red, info.green, info.blue};
-      }
-      case ColorType::TrueColor:
-      default: {
-        return {color.red_, color.green_, color.blue_};
-      }
+  float a_r = 0.F, a_g = 0.F, a_b = 0.F;  // NOLINT
+  float b_r = 0.F, b_g = 0.F, b_b = 0.F;  // NOLINT
+  a.ToLinear(a_r, a_g, a_b);
+  b.ToLinear(b_r, b_g, b_b);
+  for (size_t i = 0; i < size; ++i) {
+    const float u = t[i];  // NOLINT
+    const float v = 1.F - u;
+    out[i] = Color::RGB(FromLinear(a_r * v + b_r * u),  // NOLINT
+                        FromLinear(a_g * v + b_g * u),  //
+                        FromLinear(a_b * v + b_b * u));
+  }
+}
+
+void Color::ToLinear(float& red, float& green, float& blue) const {
+  const auto& table = LinearTable();
+  switch (type_) {
+    case ColorType::Palette1: {
+      red = green = blue = 0.F;
+      return;
+    }
+    case ColorType::Palette16: {
+      const ColorInfo info = GetColorInfo(Color::Palette16(red_));
+      red = table[info.red];
+      green = table[info.green];
+      blue = table[info.blue];
+      return;
     }
-  };
-
-  const auto [a_r, a_g, a_b] = to_rgb(a);
-  const auto [b_r, b_g, b_b] = to_rgb(b);
-
-  // Gamma correction:
-  // https://en.wikipedia.org/wiki/Gamma_correction
-  auto interp = [t](uint8_t a_u, uint8_t b_u) {
-    constexpr float gamma = 2.2F;
-    const float a_f = std::pow(a_u, gamma);
-    const float b_f = std::pow(b_u, gamma);
-    const float c_f = a_f * (1.0F - t) +  //
-                      b_f * t;
-    return static_cast<uint8_t>(std::pow(c_f, 1.F / gamma));
-  };
-  return Color::RGB(interp(a_r, b_r),   //
-                    interp(a_g, b_g),   //
-                    interp(a_b, b_b));  //
+    case ColorType::Palette256: {
+      const ColorInfo info = GetColorInfo(Color::Palette256(red_));
+      red = table[info.red];
+      green = table[info.green];
+      blue = table[info.blue];
+      return;
+    }
+    case ColorType::TrueColor:
+    default: {
+      red = table[red_];
+      green = table[green_];
+      blue = table[blue_];
+      return;
+    }
+  }
 }
 
 /// @brief Blend two colors together using the alpha channel.
 // static
 Color Color::Blend(const Color& lhs, const Color& rhs) {
-  Color out = Interpolate(float(rhs.alpha_) / 255.F, lhs, rhs);
-  out.alpha_ = lhs.alpha_ + rhs.alpha_ - lhs.alpha_ * rhs.alpha_ / 255;
+  Color out = lhs;
+  Blend(&out, rhs, 1);
+  return out;
+}
+
+/// @brief Blend `rhs` over every color of a row, in place.
+/// This is equivalent to, but faster than, calling Blend for each color.
+/// @param lhs The colors to blend over. They are replaced by the result.
+/// @param rhs The color blended over them, using its alpha channel.
+/// @param size The number of colors.
+// static
+void Color::Blend(Color* lhs, const Color& rhs, size_t size) {
+  const float t = float(rhs.alpha_) / 255.F;
+  float b_r = 0.F, b_g = 0.F, b_b = 0.F;  // NOLINT
+  rhs.ToLinear(b_r, b_g, b_b);
+
+  // Translucent overlays are usually drawn over uniform areas. Reuse the
+  // previous result when the input repeats.
+  Color previous_in;
+  Color previous_out;
+  bool has_previous = false;
+  for (size_t i = 0; i < size; ++i) {
+    Color& color = lhs[i];  // NOLINT
+    if (has_previous && color == previous_in &&
+        color.alpha_ == previous_in.alpha_) {
+      color = previous_out;
+      continue;
+    }
+    previous_in = color;
+    has_previous = true;
+
+    if (color.type_ == ColorType::Palette1 ||
+        rhs.type_ == ColorType::Palette1) {
+      color = t < 0.5F ? color : rhs;  // NOLINT
+    } else {
+      float a_r = 0.F, a_g = 0.F, a_b = 0.F;  // NOLINT
+      color.ToLinear(a_r, a_g, a_b);
+      const float v = 1.F - t;
+      color = Color::RGB(FromLinear(a_r * v + b_r * t),  //
+                         FromLinear(a_g * v + b_g * t),  //
+                         FromLinear(a_b * v + b_b * t));
+    }
+    color.alpha_ = static_cast<uint8_t>(previous_in.alpha_ + rhs.alpha_ -
+                                        previous_in.alpha_ * rhs.alpha_ / 255);
+    previous_out = color;
+  }
+}
+
+/// @brief Return the nearest color of the 256 colors palette. This is used to
+/// reduce the size of the output, regardless of the terminal color support.
+/// Colors not using TrueColor are returned unchanged.
+Color Color::ToPalette256() const {
+  if (type_ != ColorType::TrueColor) {
+    return *this;
+  }
+  Color out;
+  out.type_ = ColorType::Palette256;
+  out.red_ = NearestPalette256(red_, green_, blue_);
+  out.alpha_ = alpha_;
   return out;
 }
 
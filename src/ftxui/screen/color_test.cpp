@@ -3,9 +3,12 @@
 // the LICENSE file.
 #include "ftxui/screen/color.hpp"
 #include <gtest/gtest.h>
+#include <cmath>    // for pow
+#include <cstdint>  // for uint8_t
 #include <cstdlib>  // for std::getenv, setenv, unsetenv
 #include <optional>
 #include <string>
+#include "ftxui/screen/color_info.hpp"
 #include "ftxui/screen/terminal.hpp"
 
 namespace ftxui {
@@ -206,4 +209,191 @@ TEST(ColorTest, FallbackToPalette1) {
   Terminal::SetColorSupport(Terminal::Color::TrueColor);
 }
 
+TEST(ColorTest, QuirksSnapshot) {
+  const Terminal::Quirks saved = Terminal::GetQuirks();
+
+  Terminal::SetColorSupport(Terminal::Color::Palette16);
+  EXPECT_EQ(Terminal::GetQuirksSnapshot().color_support,
+            Terminal::Color::Palette16);
+
+  Terminal::Quirks quirks = saved;
+  quirks.SetBlockCharacters(false);
+  quirks.SetComponentAscii(true);
+  quirks.SetColorSupport(Terminal::Color::Palette256);
+  Terminal::SetQuirks(quirks);
+  const Terminal::QuirksSnapshot& snapshot = Terminal::GetQuirksSnapshot();
+  EXPECT_FALSE(snapshot.block_characters);
+  EXPECT_TRUE(snapshot.component_ascii);
+  EXPECT_EQ(snapshot.color_support, Terminal::Color::Palette256);
+  EXPECT_EQ(Terminal::ColorSupport(), Terminal::Color::Palette256);
+
+  Terminal::SetQuirks(saved);
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+}
+
+// The quantization must match an exhaustive search over the 256 palette.
+TEST(ColorTest, FallbackTo256MatchesExhaustiveSearch) {
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  auto nearest = [](int red, int green, int blue) {
+    int closest = 256 * 256 * 3;
+    int best = 0;
+    for (int i = 16; i < 256; ++i) {
+      const ColorInfo info = GetColorInfo(Color::Palette256(i));
+      const int dr = info.red - red;
+      const int dg = info.green - green;
+      const int db = info.blue - blue;
+      const int dist = dr * dr + dg * dg + db * db;
+      if (closest > dist) {
+        closest = dist;
+        best = i;
+      }
+    }
+    return best;
+  };
+  auto check = [&](int red, int green, int blue) {
+    EXPECT_EQ(Color::RGB(red, green, blue).Print(false),
+              Color(Color::Palette256(nearest(red, green, blue))).Print(false))
+        << red << " " << green << " " << blue;
+  };
+  for (int red = 0; red < 256; red += 7) {
+    for (int green = 0; green < 256; green += 7) {
+      for (int blue = 0; blue < 256; blue += 7) {
+        check(red, green, blue);
+      }
+    }
+  }
+  for (int grey = 0; grey < 256; ++grey) {
+    check(grey, grey, grey);
+    check(grey, grey, 255 - grey);
+  }
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+}
+
+namespace {
+
+// Interpolate a channel in linear space, using std::pow, like the scalar
+// implementation the batched one replaced.
+uint8_t ReferenceInterpolate(float t, uint8_t a, uint8_t b) {
+  constexpr float gamma = 2.2F;
+  const float a_f = std::pow(a, gamma);
+  const float b_f = std::pow(b, gamma);
+  const float c_f = a_f * (1.0F - t) +  //
+                    b_f * t;
+  return static_cast<uint8_t>(std::pow(c_f, 1.F / gamma));
+}
+
+struct RGB {
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+};
+
+Color ReferenceInterpolate(float t, RGB a, RGB b) {
+  return Color::RGB(ReferenceInterpolate(t, a.red, b.red),
+                    ReferenceInterpolate(t, a.green, b.green),
+                    ReferenceInterpolate(t, a.blue, b.blue));
+}
+
+}  // namespace
+
+TEST(ColorTest, InterpolateValues) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const Color black = Color::RGB(0, 0, 0);
+  const Color white = Color::RGB(255, 255, 255);
+  EXPECT_EQ(Color::Interpolate(0.F, black, white), black);
+  // The conversion back from linear space truncates.
+  EXPECT_EQ(Color::Interpolate(1.F, black, white), Color::RGB(254, 254, 254));
+  EXPECT_EQ(Color::Interpolate(0.5F, black, white), Color::RGB(186, 186, 186));
+  EXPECT_EQ(Color::Interpolate(0.5F, white, black), Color::RGB(186, 186, 186));
+  EXPECT_EQ(Color::Interpolate(0.25F, Color::RGB(255, 0, 0),
+                               Color::RGB(0, 0, 255)),
+            Color::RGB(223, 0, 135));
+}
+
+TEST(ColorTest, InterpolateBatch) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const Color a = Color::RGB(12, 200, 37);
+  const Color b = Color::Palette256(123);
+  const ColorInfo info = GetColorInfo(Color::Palette256(123));
+  const RGB a_rgb = {12, 200, 37};
+  const RGB b_rgb = {info.red, info.green, info.blue};
+  const float t[] = {0.F, 0.1F, 0.25F, 0.5F, 0.75F, 0.9F, 1.F};
+  Color out[7];
+  Color::Interpolate(t, a, b, out, 7);
+  for (int i = 0; i < 7; ++i) {
+    EXPECT_EQ(out[i], ReferenceInterpolate(t[i], a_rgb, b_rgb)) << t[i];
+  }
+}
+
+// Every pair of channel values gives the same result as the reference.
+TEST(ColorTest, InterpolateAllChannels) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const float t[] = {0.F, 0.1F, 0.25F, 100.F / 255.F, 0.5F, 0.9F, 1.F};
+  Color out[7];
+  for (int a = 0; a < 256; ++a) {
+    for (int b = 0; b < 256; b += 3) {
+      Color::Interpolate(t, Color::RGB(a, a, a), Color::RGB(b, b, b), out, 7);
+      for (int i = 0; i < 7; ++i) {
+        const uint8_t expected = ReferenceInterpolate(t[i], a, b);
+        ASSERT_EQ(out[i], Color::RGB(expected, expected, expected))
+            << a << " " << b << " " << t[i];
+      }
+    }
+  }
+}
+
+TEST(ColorTest, BlendBatch) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const Color rhs = Color::RGBA(255, 128, 0, 100);
+  const RGB rhs_rgb = {255, 128, 0};
+  const float t = 100.F / 255.F;
+  Color colors[] = {
+      Color::RGB(0, 0, 0),
+      Color::RGB(0, 0, 0),
+      Color::RGBA(10, 20, 30, 50),
+      Color::RGB(255, 255, 255),
+  };
+  const Color expected[] = {
+      ReferenceInterpolate(t, {0, 0, 0}, rhs_rgb),
+      ReferenceInterpolate(t, {0, 0, 0}, rhs_rgb),
+      ReferenceInterpolate(t, {10, 20, 30}, rhs_rgb),
+      ReferenceInterpolate(t, {255, 255, 255}, rhs_rgb),
+  };
+  Color::Blend(colors, rhs, 4);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(colors[i], expected[i]) << i;
+  }
+
+  // An opaque color replaces, up to the truncation. A transparent one keeps.
+  EXPECT_EQ(Color::Blend(Color::RGB(1, 2, 3), Color::RGB(255, 0, 255)),
+            Color::RGB(254, 0, 254));
+  EXPECT_EQ(Color::Blend(Color::RGB(1, 2, 3), Color::RGBA(255, 0, 255, 0)),
+            Color::RGB(1, 2, 3));
+}
+
+TEST(ColorTest, ToPalette256) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  EXPECT_EQ(Color::RGB(255, 0, 0).ToPalette256().Print(false), "38;5;196");
+  EXPECT_EQ(Color::RGB(8, 8, 8).ToPalette256().Print(true), "48;5;232");
+  EXPECT_EQ(Color(Color::Red).ToPalette256(), Color(Color::Red));
+  EXPECT_EQ(Color(Color::Default).ToPalette256(), Color(Color::Default));
+  EXPECT_FALSE(Color::RGBA(255, 0, 0, 128).ToPalette256().IsOpaque());
+
+  // The same as what a terminal supporting 256 colors gets.
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  const Color expected = Color::RGB(12, 200, 99);
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  EXPECT_EQ(Color::RGB(12, 200, 99).ToPalette256().Print(false),
+            expected.Print(false));
+}
+
+// Equal colors have the same hash, whatever bytes they don't compare.
+TEST(ColorTest, Hash) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  EXPECT_EQ(Color::RGBA(1, 2, 3, 10), Color::RGBA(1, 2, 3, 20));
+  EXPECT_EQ(Color::RGBA(1, 2, 3, 10).Hash(), Color::RGBA(1, 2, 3, 20).Hash());
+  EXPECT_NE(Color::RGB(1, 2, 3).Hash(), Color::RGB(1, 2, 4).Hash());
+  EXPECT_NE(Color(Color::Red).Hash(), Color(Color::Palette256(1)).Hash());
+}
+
 }  // namespace ftxui
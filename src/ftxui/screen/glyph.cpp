@@ -0,0 +1,178 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/glyph.hpp"
+
+#include <array>          // for array
+#include <atomic>         // for atomic, memory_order_acquire, memory_order_relaxed
+#include <cstdint>        // for uint32_t, uint8_t
+#include <cstring>        // for memcpy
+#include <mutex>          // for mutex, lock_guard
+#include <ostream>        // for ostream
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
+#include "ftxui/screen/string.hpp"  // for string_width
+
+namespace ftxui {
+
+namespace {
+
+// The graphemes that do not fit inline, with the number of Glyph referring to
+// them. An entry is reclaimed once no Glyph refers to it anymore, so the pool
+// only holds the graphemes alive.
+//
+// The entries are stored in chunks, which are never moved nor freed. Reading
+// an entry doesn't lock: the Glyph reading it holds a reference, so it can't be
+// modified concurrently.
+class GlyphPool {
+ public:
+  static constexpr uint32_t kFull = 0xFFFFFFFF;
+
+  // Returns the id of |glyph|, holding a reference to it. Returns kFull when
+  // the pool can't hold any more graphemes.
+  uint32_t Intern(std::string_view glyph) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(glyph);
+    if (it != ids_.end()) {
+      At(it->second).references.fetch_add(1, std::memory_order_relaxed);
+      return it->second;
+    }
+
+    uint32_t id = 0;
+    if (!free_.empty()) {
+      id = free_.back();
+      free_.pop_back();
+    } else {
+      if (size_ == kChunkSize * kChunkCount) {
+        return kFull;
+      }
+      id = size_++;
+      auto& chunk = chunks_[id / kChunkSize];
+      if (!chunk.load(std::memory_order_relaxed)) {
+        chunk.store(new Entry[kChunkSize], std::memory_order_release);
+      }
+    }
+
+    Entry& entry = At(id);
+    entry.glyph = glyph;
+    entry.references.store(1, std::memory_order_relaxed);
+    entry.live = true;
+    ids_.emplace(entry.glyph, id);
+    return id;
+  }
+
+  std::string_view Get(uint32_t id) const { return At(id).glyph; }
+
+  void Acquire(uint32_t id) {
+    At(id).references.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Release(uint32_t id) {
+    Entry& entry = At(id);
+    if (entry.references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+    const std::lock_guard<std::mutex> lock(mutex_);
+    // It might have been interned again, or reclaimed, in the meantime.
+    if (!entry.live || entry.references.load(std::memory_order_relaxed) != 0) {
+      return;
+    }
+    entry.live = false;
+    ids_.erase(entry.glyph);
+    entry.glyph = std::string();
+    free_.push_back(id);
+  }
+
+  size_t size() {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return ids_.size();
+  }
+
+ private:
+  static constexpr uint32_t kChunkSize = 1024;
+  static constexpr uint32_t kChunkCount = 65536;
+
+  struct Entry {
+    std::string glyph;
+    std::atomic<uint32_t> references{0};
+    bool live = false;  // Guarded by |mutex_|.
+  };
+
+  Entry& At(uint32_t id) const {
+    Entry* chunk = chunks_[id / kChunkSize].load(std::memory_order_acquire);
+    return chunk[id % kChunkSize];
+  }
+
+  std::array<std::atomic<Entry*>, kChunkCount> chunks_{};
+
+  // Guard the creation and the reclamation of the entries.
+  std::mutex mutex_;
+  std::unordered_map<std::string_view, uint32_t> ids_;
+  std::vector<uint32_t> free_;
+  uint32_t size_ = 0;
+};
+
+// Never destroyed, so that the glyphs with static storage can outlive it.
+GlyphPool& Pool() {
+  static auto* pool = new GlyphPool();  // NOLINT
+  return *pool;
+}
+
+uint32_t Id(const char* bytes) {
+  uint32_t id = 0;
+  std::memcpy(&id, bytes, sizeof(id));
+  return id;
+}
+
+}  // namespace
+
+void Glyph::Assign(std::string_view glyph) {
+  // A single byte is never fullwidth. Skip the UTF-8 decoding.
+  const uint8_t full_width =
+      (glyph.size() > 1 && string_width(glyph) == 2) ? kFullWidth : 0;
+
+  // Release the previous grapheme last: |glyph| may refer to it.
+  const Glyph previous = std::move(*this);
+
+  if (glyph.size() <= sizeof(bytes_)) {
+    bytes_[0] = bytes_[1] = bytes_[2] = bytes_[3] = 0;
+    std::memcpy(bytes_, glyph.data(), glyph.size());
+    flags_ = static_cast<uint8_t>(glyph.size()) | full_width;
+    return;
+  }
+
+  const uint32_t id = Pool().Intern(glyph);
+  if (id == GlyphPool::kFull) {
+    Assign("\uFFFD");  // The replacement character.
+    return;
+  }
+  static_assert(sizeof(id) == sizeof(bytes_));
+  std::memcpy(bytes_, &id, sizeof(id));
+  flags_ = kInterned | full_width;
+}
+
+std::string_view Glyph::Interned() const {
+  return Pool().Get(Id(bytes_));
+}
+
+void Glyph::Acquire() const {
+  Pool().Acquire(Id(bytes_));
+}
+
+void Glyph::Release() const {
+  Pool().Release(Id(bytes_));
+}
+
+size_t Glyph::InternedCount() {
+  return Pool().size();
+}
+
+std::ostream& operator<<(std::ostream& os, const Glyph& glyph) {
+  return os << glyph.str();
+}
+
+}  // namespace ftxui
@@ -0,0 +1,123 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/glyph.hpp"
+#include <gtest/gtest.h>
+#include <string>                   // for string, to_string
+#include <utility>                  // for move
+#include <vector>                   // for vector
+#include "ftxui/screen/cell.hpp"    // for Cell
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+TEST(GlyphTest, Size) {
+  EXPECT_EQ(sizeof(Glyph), 5u);
+  EXPECT_LE(sizeof(Cell), 20u);
+}
+
+TEST(GlyphTest, Empty) {
+  Glyph glyph;
+  EXPECT_TRUE(glyph.empty());
+  EXPECT_EQ(glyph.size(), 0u);
+  EXPECT_EQ(glyph, "");
+  EXPECT_EQ(glyph, Glyph(""));
+}
+
+TEST(GlyphTest, Inline) {
+  for (const std::string str : {"a", "é", "─", "测", "😀"}) {
+    const Glyph glyph = str;
+    EXPECT_FALSE(glyph.empty());
+    EXPECT_EQ(glyph.size(), str.size());
+    EXPECT_EQ(glyph, str);
+    EXPECT_EQ(str, glyph);
+    EXPECT_EQ(std::string(glyph), str);
+    EXPECT_EQ(glyph[0], str[0]);
+  }
+  EXPECT_NE(Glyph("a"), Glyph("b"));
+  EXPECT_NE(Glyph("a"), "ab");
+}
+
+TEST(GlyphTest, Interned) {
+  const std::string family = "👨‍👩‍👧";
+  const std::string combining = "e\u0301\u0302";
+  const Glyph a = family;
+  const Glyph b = combining;
+  EXPECT_EQ(a, family);
+  EXPECT_EQ(b, combining);
+  EXPECT_EQ(a.size(), family.size());
+  EXPECT_NE(a, b);
+
+  // The same grapheme always produces the same representation.
+  EXPECT_EQ(a, Glyph(family));
+  EXPECT_EQ(b, Glyph(combining));
+}
+
+TEST(GlyphTest, Reassign) {
+  Glyph glyph = "👨‍👩‍👧";
+  glyph = "x";
+  EXPECT_EQ(glyph, "x");
+  EXPECT_EQ(glyph, Glyph("x"));
+  glyph = "ab";
+  EXPECT_EQ(glyph, "ab");
+  EXPECT_EQ(glyph, Glyph("ab"));
+}
+
+TEST(GlyphTest, FullWidth) {
+  EXPECT_FALSE(Glyph().full_width());
+  EXPECT_FALSE(Glyph("a").full_width());
+  EXPECT_FALSE(Glyph("─").full_width());
+  EXPECT_FALSE(Glyph("⣿").full_width());
+  EXPECT_FALSE(Glyph("e\u0301\u0302").full_width());
+  EXPECT_TRUE(Glyph("测").full_width());
+  EXPECT_TRUE(Glyph("😀").full_width());
+
+  Glyph glyph = "测";
+  glyph = "a";
+  EXPECT_FALSE(glyph.full_width());
+}
+
+TEST(GlyphTest, Append) {
+  Glyph glyph = "e";
+  glyph += "\u0301";
+  EXPECT_EQ(glyph, "e\u0301");
+  glyph += "\u0302";
+  EXPECT_EQ(glyph, "e\u0301\u0302");
+  EXPECT_EQ(glyph, Glyph("e\u0301\u0302"));
+}
+
+// The interned graphemes are reclaimed once no glyph refers to them.
+TEST(GlyphTest, Reclaimed) {
+  const size_t initial = Glyph::InternedCount();
+  {
+    auto screen = Screen(100, 10);
+    for (int i = 0; i < 1000; ++i) {
+      screen.at(i % 100, i / 100) = "e\u0301" + std::to_string(1000 + i);
+    }
+    const Glyph copy = screen.at(42, 0);
+    EXPECT_EQ(Glyph::InternedCount(), initial + 1000);
+
+    screen.Clear();
+    EXPECT_EQ(Glyph::InternedCount(), initial + 1);
+    EXPECT_EQ(copy, "e\u03011042");
+  }
+  EXPECT_EQ(Glyph::InternedCount(), initial);
+
+  // The same grapheme, interned again.
+  const Glyph a = "e\u0301\u0302";
+  Glyph b = a;
+  Glyph c = std::move(b);
+  EXPECT_EQ(Glyph::InternedCount(), initial + 1);
+  EXPECT_EQ(c, a);
+  EXPECT_TRUE(b.empty());
+}
+
+TEST(GlyphTest, Screen) {
+  auto screen = Screen(3, 1);
+  screen.at(0, 0) = "a";
+  screen.at(1, 0) = "e\u0301\u0302";
+  screen.at(2, 0) = "b";
+  EXPECT_EQ(screen.ToString(), "ae\u0301\u0302b");
+}
+
+}  // namespace ftxui
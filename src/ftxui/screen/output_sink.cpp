@@ -0,0 +1,112 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/output_sink.hpp"
+
+#include <cstring>      // for memcpy
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#if defined(_WIN32)
+#include <io.h>  // for _write
+#else
+#include <poll.h>    // for poll, pollfd, POLLOUT
+#include <unistd.h>  // for write, ssize_t
+#include <cerrno>    // for errno, EAGAIN, EINTR, EWOULDBLOCK
+#endif
+
+namespace ftxui {
+
+namespace {
+
+// Write the whole |data| to |fd|. Retry on partial writes and interruptions,
+// and wait for the file descriptor to become writable when it is
+// non-blocking.
+void WriteAll(int fd, std::string_view data) {
+#if defined(_WIN32)
+  while (!data.empty()) {
+    const int written =
+        _write(fd, data.data(), static_cast<unsigned int>(data.size()));
+    if (written <= 0) {
+      return;  // The output is gone. Drop the frame.
+    }
+    data.remove_prefix(static_cast<size_t>(written));
+  }
+#else
+  while (!data.empty()) {
+    const ssize_t written = write(fd, data.data(), data.size());
+    if (written >= 0) {
+      data.remove_prefix(static_cast<size_t>(written));
+      continue;
+    }
+    if (errno == EINTR) {
+      continue;
+    }
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      struct pollfd pfd = {fd, POLLOUT, 0};
+      poll(&pfd, 1, -1);
+      continue;
+    }
+    return;  // The output is gone. Drop the frame.
+  }
+#endif
+}
+
+}  // namespace
+
+/// @brief Write into |buffer|, and pass its content to |callback| every time
+/// it is full.
+/// @param buffer The buffer. It must outlive the sink.
+/// @param capacity The size of the buffer.
+/// @param callback Receive the data flushed.
+OutputSink::OutputSink(char* buffer, size_t capacity, Callback callback)
+    : buffer_(buffer), capacity_(capacity), callback_(std::move(callback)) {}
+
+/// @brief Write into |buffer|, and write its content to the file descriptor
+/// |fd| every time it is full.
+/// @param buffer The buffer. It must outlive the sink.
+/// @param capacity The size of the buffer.
+/// @param fd The file descriptor to write to.
+OutputSink::OutputSink(char* buffer, size_t capacity, int fd)
+    : OutputSink(buffer, capacity,
+                 [fd](std::string_view data) { WriteAll(fd, data); }) {}
+
+OutputSink::~OutputSink() {
+  Flush();
+}
+
+/// @brief Append |data|, flushing the buffer as it fills.
+OutputSink& OutputSink::operator+=(std::string_view data) {
+  if (data.empty()) {
+    return *this;
+  }
+  written_ += data.size();
+  if (data.size() <= capacity_ - size_) {
+    std::memcpy(buffer_ + size_, data.data(), data.size());
+    size_ += data.size();
+    return *this;
+  }
+
+  Flush();
+
+  // Too large to be buffered. Pass it through rather than splitting it.
+  if (data.size() >= capacity_) {
+    callback_(data);
+    return *this;
+  }
+
+  std::memcpy(buffer_, data.data(), data.size());
+  size_ = data.size();
+  return *this;
+}
+
+/// @brief Pass the buffered data to the destination, and empty the buffer.
+void OutputSink::Flush() {
+  if (size_ == 0) {
+    return;
+  }
+  callback_(std::string_view(buffer_, size_));
+  size_ = 0;
+}
+
+}  // namespace ftxui
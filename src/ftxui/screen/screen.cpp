@@ -1,20 +1,24 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <cstddef>  // for size_t
+#include <algorithm>  // for max, min
+#include <array>      // for array
+#include <cstddef>    // for size_t
 #include <cstdint>
-#include <iostream>  // for cout, flush
+#include <functional>  // for hash
+#include <iostream>    // for cout, flush
 #include <limits>
-#include <map>     // for _Rb_tree_const_iterator, map, operator!=, operator==
-#include <string>  // for string
+#include <string>       // for string
 #include <string_view>  // for string_view
 #include <utility>      // for pair
+#include <vector>       // for vector
 
-#include "ftxui/screen/cell.hpp"  // for Cell
+#include "ftxui/screen/cell.hpp"         // for Cell
+#include "ftxui/screen/output_sink.hpp"  // for OutputSink
 #include "ftxui/screen/screen.hpp"
-#include "ftxui/screen/string.hpp"    // for string_width
-#include "ftxui/screen/surface.hpp"   // for Surface
-#include "ftxui/screen/terminal.hpp"  // for Dimensions, Size
+#include "ftxui/screen/surface.hpp"      // for Surface
+#include "ftxui/screen/terminal.hpp"     // for Dimensions, Size
+#include "ftxui/screen/thread_pool.hpp"  // for ThreadPool
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -75,8 +79,9 @@ void WindowsEmulateVT100Terminal() {
 #endif
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
+template <typename Output>
 void UpdateCellStyle(const Screen* screen,
-                     std::string& ss,
+                     Output& ss,
                      const Cell& prev,
                      const Cell& next) {
   // See https://gist.github.com/egmontkob/eb114294efbcd5adb1944c9f3cb5feda
@@ -143,245 +148,430 @@ void UpdateCellStyle(const Screen* screen,
   }
 }
 
+// Whether two cells, each belonging to its own screen, are displayed the same
+// way on the terminal.
+bool SameCell(const Screen& a_screen,
+              const Cell& a,
+              const Screen& b_screen,
+              const Cell& b) {
+  if (a.character != b.character ||
+      a.foreground_color != b.foreground_color ||
+      a.background_color != b.background_color || a.bold != b.bold ||
+      a.dim != b.dim || a.italic != b.italic || a.inverted != b.inverted ||
+      a.underlined != b.underlined ||
+      a.underlined_double != b.underlined_double ||
+      a.strikethrough != b.strikethrough || a.blink != b.blink) {
+    return false;
+  }
+
+  // Hyperlink ids are local to their screen. Compare the links themselves.
+  if (a.hyperlink == 0 && b.hyperlink == 0) {
+    return true;
+  }
+  return a_screen.Hyperlink(a.hyperlink) == b_screen.Hyperlink(b.hyperlink);
+}
+
+// A hash of a line, equal for lines whose cells are the SameCell.
+size_t HashLine(const Screen& screen, const Cell* line, int dimx) {
+  size_t hash = 0;
+  auto combine = [&](size_t value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);  // NOLINT
+  };
+  for (int x = 0; x < dimx; ++x) {
+    const Cell& cell = line[x];
+    combine(std::hash<std::string_view>()(cell.character.str()));
+    combine(cell.foreground_color.Hash());
+    combine(cell.background_color.Hash());
+    combine((size_t(cell.bold) << 0) | (size_t(cell.dim) << 1) |
+            (size_t(cell.italic) << 2) | (size_t(cell.inverted) << 3) |
+            (size_t(cell.underlined) << 4) |
+            (size_t(cell.underlined_double) << 5) |
+            (size_t(cell.strikethrough) << 6) | (size_t(cell.blink) << 7));
+    if (cell.hyperlink != 0) {
+      combine(std::hash<std::string>()(screen.Hyperlink(cell.hyperlink)));
+    }
+  }
+  return hash;
+}
+
+// A range of rows [top, bottom] whose content moved by |shift| rows. Positive
+// shifts move the content up.
+struct Scroll {
+  int top = 0;
+  int bottom = -1;
+  int shift = 0;
+  int gain = 0;
+};
+
+// Find the block of rows in |next| equal to the rows of |previous| shifted
+// vertically, saving the largest number of rows to repaint.
+Scroll FindScroll(const std::vector<size_t>& next,
+                  const std::vector<size_t>& previous) {
+  const int dimy = static_cast<int>(next.size());
+  Scroll best;
+  for (int shift = 1 - dimy; shift < dimy; ++shift) {
+    if (shift == 0) {
+      continue;
+    }
+    const int y_begin = std::max(0, -shift);
+    const int y_end = std::min(dimy, dimy - shift);
+    int run_start = y_begin;
+    int gain = 0;
+    for (int y = y_begin; y <= y_end; ++y) {
+      if (y != y_end && next[y] == previous[y + shift]) {
+        gain += (next[y] != previous[y]);
+        continue;
+      }
+      if (gain > best.gain) {
+        // The scrolling region includes the rows the content comes from.
+        const int top = std::min(run_start, run_start + shift);
+        const int bottom = std::max(y - 1, y - 1 + shift);
+        // The rows exposed by the scroll are blank. They must be repainted,
+        // even if they were up to date.
+        for (int exposed = top; exposed <= bottom; ++exposed) {
+          if ((exposed < run_start || exposed >= y) &&
+              next[exposed] == previous[exposed]) {
+            gain--;
+          }
+        }
+        if (gain > best.gain) {
+          best = {top, bottom, shift, gain};
+        }
+      }
+      run_start = y + 1;
+      gain = 0;
+    }
+  }
+  return best;
+}
+
+// Move the cursor from (|x|, |y|) to (|target_x|, |target_y|), relatively to
+// the top-left corner of the screen. A negative |x| means the column is
+// unknown.
+template <typename Output>
+void MoveCursor(Output& ss, int& x, int& y, int target_x, int target_y) {
+  if (target_y != y) {
+    ss += "\x1B[" + std::to_string(target_y - y) + "B";  // MOVE_DOWN
+    y = target_y;
+  }
+
+  if (target_x == x) {
+    return;
+  }
+
+  if (target_x == 0) {
+    ss += '\r';  // MOVE_LEFT
+  } else if (x >= 0 && target_x > x) {
+    ss += "\x1B[" + std::to_string(target_x - x) + "C";  // MOVE_RIGHT
+  } else {
+    ss += "\x1B[" + std::to_string(target_x + 1) + "G";  // MOVE_TO_COLUMN
+  }
+  x = target_x;
+}
+
+template <typename Output>
+void AppendSpaces(Output& ss, int count) {
+  constexpr std::string_view spaces = "                                ";
+  while (count > 0) {
+    const int n = std::min(count, static_cast<int>(spaces.size()));
+    ss += spaces.substr(0, static_cast<size_t>(n));
+    count -= n;
+  }
+}
+
+// Box drawing characters are in the range U+2500..U+257F. Their UTF-8
+// encoding is E2 94 80..E2 95 BF. They are identified by their index in this
+// range.
+constexpr int kBoxFirst = 0x2500;
+constexpr int kBoxCount = 0x80;
+constexpr std::uint8_t kNoBox = 0xFF;
+
 struct TileEncoding {
-  std::uint8_t left : 2;
-  std::uint8_t top : 2;
-  std::uint8_t right : 2;
-  std::uint8_t down : 2;
-  std::uint8_t round : 1;
-
-  // clang-format off
-  bool operator<(const TileEncoding& other) const {
-    if (left < other.left)   { return  true;  }
-    if (left > other.left)   { return  false; }
-    if (top < other.top)     { return  true;  }
-    if (top > other.top)     { return  false; }
-    if (right < other.right) { return  true;  }
-    if (right > other.right) { return  false; }
-    if (down < other.down)   { return  true;  }
-    if (down > other.down)   { return  false; }
-    if (round < other.round) { return  true;  }
-    if (round > other.round) { return  false; }
-      return false;
-  }
-  // clang-format on
+  std::uint8_t left = 0;
+  std::uint8_t top = 0;
+  std::uint8_t right = 0;
+  std::uint8_t down = 0;
+  std::uint8_t round = 0;
+};
+
+// Pack a TileEncoding into 9 bits, to index the dense tables below.
+constexpr int kTileEncodingCount = 1 << 9;
+constexpr std::uint16_t kNoTile = 0xFFFF;
+
+constexpr std::uint16_t Pack(const TileEncoding& e) {
+  return static_cast<std::uint16_t>(e.left | (e.top << 2) | (e.right << 4) |
+                                    (e.down << 6) | (e.round << 8));
+}
+
+constexpr TileEncoding Unpack(std::uint16_t packed) {
+  TileEncoding e;
+  e.left = packed & 0b11;
+  e.top = (packed >> 2) & 0b11;
+  e.right = (packed >> 4) & 0b11;
+  e.down = (packed >> 6) & 0b11;
+  e.round = (packed >> 8) & 0b1;
+  return e;
+}
+
+struct Tile {
+  char16_t codepoint;
+  TileEncoding encoding;
 };
 
 // clang-format off
-const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
-    {"─", {1, 0, 1, 0, 0}},
-    {"━", {2, 0, 2, 0, 0}},
-    {"╍", {2, 0, 2, 0, 0}},
-
-    {"│", {0, 1, 0, 1, 0}},
-    {"┃", {0, 2, 0, 2, 0}},
-    {"╏", {0, 2, 0, 2, 0}},
-
-    {"┌", {0, 0, 1, 1, 0}},
-    {"┍", {0, 0, 2, 1, 0}},
-    {"┎", {0, 0, 1, 2, 0}},
-    {"┏", {0, 0, 2, 2, 0}},
-
-    {"┐", {1, 0, 0, 1, 0}},
-    {"┑", {2, 0, 0, 1, 0}},
-    {"┒", {1, 0, 0, 2, 0}},
-    {"┓", {2, 0, 0, 2, 0}},
-
-    {"└", {0, 1, 1, 0, 0}},
-    {"┕", {0, 1, 2, 0, 0}},
-    {"┖", {0, 2, 1, 0, 0}},
-    {"┗", {0, 2, 2, 0, 0}},
-
-    {"┘", {1, 1, 0, 0, 0}},
-    {"┙", {2, 1, 0, 0, 0}},
-    {"┚", {1, 2, 0, 0, 0}},
-    {"┛", {2, 2, 0, 0, 0}},
-
-    {"├", {0, 1, 1, 1, 0}},
-    {"┝", {0, 1, 2, 1, 0}},
-    {"┞", {0, 2, 1, 1, 0}},
-    {"┟", {0, 1, 1, 2, 0}},
-    {"┠", {0, 2, 1, 2, 0}},
-    {"┡", {0, 2, 2, 1, 0}},
-    {"┢", {0, 1, 2, 2, 0}},
-    {"┣", {0, 2, 2, 2, 0}},
-
-    {"┤", {1, 1, 0, 1, 0}},
-    {"┥", {2, 1, 0, 1, 0}},
-    {"┦", {1, 2, 0, 1, 0}},
-    {"┧", {1, 1, 0, 2, 0}},
-    {"┨", {1, 2, 0, 2, 0}},
-    {"┩", {2, 2, 0, 1, 0}},
-    {"┪", {2, 1, 0, 2, 0}},
-    {"┫", {2, 2, 0, 2, 0}},
-
-    {"┬", {1, 0, 1, 1, 0}},
-    {"┭", {2, 0, 1, 1, 0}},
-    {"┮", {1, 0, 2, 1, 0}},
-    {"┯", {2, 0, 2, 1, 0}},
-    {"┰", {1, 0, 1, 2, 0}},
-    {"┱", {2, 0, 1, 2, 0}},
-    {"┲", {1, 0, 2, 2, 0}},
-    {"┳", {2, 0, 2, 2, 0}},
-
-    {"┴", {1, 1, 1, 0, 0}},
-    {"┵", {2, 1, 1, 0, 0}},
-    {"┶", {1, 1, 2, 0, 0}},
-    {"┷", {2, 1, 2, 0, 0}},
-    {"┸", {1, 2, 1, 0, 0}},
-    {"┹", {2, 2, 1, 0, 0}},
-    {"┺", {1, 2, 2, 0, 0}},
-    {"┻", {2, 2, 2, 0, 0}},
-
-    {"┼", {1, 1, 1, 1, 0}},
-    {"┽", {2, 1, 1, 1, 0}},
-    {"┾", {1, 1, 2, 1, 0}},
-    {"┿", {2, 1, 2, 1, 0}},
-    {"╀", {1, 2, 1, 1, 0}},
-    {"╁", {1, 1, 1, 2, 0}},
-    {"╂", {1, 2, 1, 2, 0}},
-    {"╃", {2, 2, 1, 1, 0}},
-    {"╄", {1, 2, 2, 1, 0}},
-    {"╅", {2, 1, 1, 2, 0}},
-    {"╆", {1, 1, 2, 2, 0}},
-    {"╇", {2, 2, 2, 1, 0}},
-    {"╈", {2, 1, 2, 2, 0}},
-    {"╉", {2, 2, 1, 2, 0}},
-    {"╊", {1, 2, 2, 2, 0}},
-    {"╋", {2, 2, 2, 2, 0}},
-
-    {"═", {3, 0, 3, 0, 0}},
-    {"║", {0, 3, 0, 3, 0}},
-
-    {"╒", {0, 0, 3, 1, 0}},
-    {"╓", {0, 0, 1, 3, 0}},
-    {"╔", {0, 0, 3, 3, 0}},
-
-    {"╕", {3, 0, 0, 1, 0}},
-    {"╖", {1, 0, 0, 3, 0}},
-    {"╗", {3, 0, 0, 3, 0}},
-
-    {"╘", {0, 1, 3, 0, 0}},
-    {"╙", {0, 3, 1, 0, 0}},
-    {"╚", {0, 3, 3, 0, 0}},
-
-    {"╛", {3, 1, 0, 0, 0}},
-    {"╜", {1, 3, 0, 0, 0}},
-    {"╝", {3, 3, 0, 0, 0}},
-
-    {"╞", {0, 1, 3, 1, 0}},
-    {"╟", {0, 3, 1, 3, 0}},
-    {"╠", {0, 3, 3, 3, 0}},
-
-    {"╡", {3, 1, 0, 1, 0}},
-    {"╢", {1, 3, 0, 3, 0}},
-    {"╣", {3, 3, 0, 3, 0}},
-
-    {"╤", {3, 0, 3, 1, 0}},
-    {"╥", {1, 0, 1, 3, 0}},
-    {"╦", {3, 0, 3, 3, 0}},
-
-    {"╧", {3, 1, 3, 0, 0}},
-    {"╨", {1, 3, 1, 0, 0}},
-    {"╩", {3, 3, 3, 0, 0}},
-
-    {"╪", {3, 1, 3, 1, 0}},
-    {"╫", {1, 3, 1, 3, 0}},
-    {"╬", {3, 3, 3, 3, 0}},
-
-    {"╭", {0, 0, 1, 1, 1}},
-    {"╮", {1, 0, 0, 1, 1}},
-    {"╯", {1, 1, 0, 0, 1}},
-    {"╰", {0, 1, 1, 0, 1}},
-
-    {"╴", {1, 0, 0, 0, 0}},
-    {"╵", {0, 1, 0, 0, 0}},
-    {"╶", {0, 0, 1, 0, 0}},
-    {"╷", {0, 0, 0, 1, 0}},
-
-    {"╸", {2, 0, 0, 0, 0}},
-    {"╹", {0, 2, 0, 0, 0}},
-    {"╺", {0, 0, 2, 0, 0}},
-    {"╻", {0, 0, 0, 2, 0}},
-
-    {"╼", {1, 0, 2, 0, 0}},
-    {"╽", {0, 1, 0, 2, 0}},
-    {"╾", {2, 0, 1, 0, 0}},
-    {"╿", {0, 2, 0, 1, 0}},
+constexpr Tile kTiles[] = {
+    {u'─', {1, 0, 1, 0, 0}},
+    {u'━', {2, 0, 2, 0, 0}},
+    {u'╍', {2, 0, 2, 0, 0}},
+
+    {u'│', {0, 1, 0, 1, 0}},
+    {u'┃', {0, 2, 0, 2, 0}},
+    {u'╏', {0, 2, 0, 2, 0}},
+
+    {u'┌', {0, 0, 1, 1, 0}},
+    {u'┍', {0, 0, 2, 1, 0}},
+    {u'┎', {0, 0, 1, 2, 0}},
+    {u'┏', {0, 0, 2, 2, 0}},
+
+    {u'┐', {1, 0, 0, 1, 0}},
+    {u'┑', {2, 0, 0, 1, 0}},
+    {u'┒', {1, 0, 0, 2, 0}},
+    {u'┓', {2, 0, 0, 2, 0}},
+
+    {u'└', {0, 1, 1, 0, 0}},
+    {u'┕', {0, 1, 2, 0, 0}},
+    {u'┖', {0, 2, 1, 0, 0}},
+    {u'┗', {0, 2, 2, 0, 0}},
+
+    {u'┘', {1, 1, 0, 0, 0}},
+    {u'┙', {2, 1, 0, 0, 0}},
+    {u'┚', {1, 2, 0, 0, 0}},
+    {u'┛', {2, 2, 0, 0, 0}},
+
+    {u'├', {0, 1, 1, 1, 0}},
+    {u'┝', {0, 1, 2, 1, 0}},
+    {u'┞', {0, 2, 1, 1, 0}},
+    {u'┟', {0, 1, 1, 2, 0}},
+    {u'┠', {0, 2, 1, 2, 0}},
+    {u'┡', {0, 2, 2, 1, 0}},
+    {u'┢', {0, 1, 2, 2, 0}},
+    {u'┣', {0, 2, 2, 2, 0}},
+
+    {u'┤', {1, 1, 0, 1, 0}},
+    {u'┥', {2, 1, 0, 1, 0}},
+    {u'┦', {1, 2, 0, 1, 0}},
+    {u'┧', {1, 1, 0, 2, 0}},
+    {u'┨', {1, 2, 0, 2, 0}},
+    {u'┩', {2, 2, 0, 1, 0}},
+    {u'┪', {2, 1, 0, 2, 0}},
+    {u'┫', {2, 2, 0, 2, 0}},
+
+    {u'┬', {1, 0, 1, 1, 0}},
+    {u'┭', {2, 0, 1, 1, 0}},
+    {u'┮', {1, 0, 2, 1, 0}},
+    {u'┯', {2, 0, 2, 1, 0}},
+    {u'┰', {1, 0, 1, 2, 0}},
+    {u'┱', {2, 0, 1, 2, 0}},
+    {u'┲', {1, 0, 2, 2, 0}},
+    {u'┳', {2, 0, 2, 2, 0}},
+
+    {u'┴', {1, 1, 1, 0, 0}},
+    {u'┵', {2, 1, 1, 0, 0}},
+    {u'┶', {1, 1, 2, 0, 0}},
+    {u'┷', {2, 1, 2, 0, 0}},
+    {u'┸', {1, 2, 1, 0, 0}},
+    {u'┹', {2, 2, 1, 0, 0}},
+    {u'┺', {1, 2, 2, 0, 0}},
+    {u'┻', {2, 2, 2, 0, 0}},
+
+    {u'┼', {1, 1, 1, 1, 0}},
+    {u'┽', {2, 1, 1, 1, 0}},
+    {u'┾', {1, 1, 2, 1, 0}},
+    {u'┿', {2, 1, 2, 1, 0}},
+    {u'╀', {1, 2, 1, 1, 0}},
+    {u'╁', {1, 1, 1, 2, 0}},
+    {u'╂', {1, 2, 1, 2, 0}},
+    {u'╃', {2, 2, 1, 1, 0}},
+    {u'╄', {1, 2, 2, 1, 0}},
+    {u'╅', {2, 1, 1, 2, 0}},
+    {u'╆', {1, 1, 2, 2, 0}},
+    {u'╇', {2, 2, 2, 1, 0}},
+    {u'╈', {2, 1, 2, 2, 0}},
+    {u'╉', {2, 2, 1, 2, 0}},
+    {u'╊', {1, 2, 2, 2, 0}},
+    {u'╋', {2, 2, 2, 2, 0}},
+
+    {u'═', {3, 0, 3, 0, 0}},
+    {u'║', {0, 3, 0, 3, 0}},
+
+    {u'╒', {0, 0, 3, 1, 0}},
+    {u'╓', {0, 0, 1, 3, 0}},
+    {u'╔', {0, 0, 3, 3, 0}},
+
+    {u'╕', {3, 0, 0, 1, 0}},
+    {u'╖', {1, 0, 0, 3, 0}},
+    {u'╗', {3, 0, 0, 3, 0}},
+
+    {u'╘', {0, 1, 3, 0, 0}},
+    {u'╙', {0, 3, 1, 0, 0}},
+    {u'╚', {0, 3, 3, 0, 0}},
+
+    {u'╛', {3, 1, 0, 0, 0}},
+    {u'╜', {1, 3, 0, 0, 0}},
+    {u'╝', {3, 3, 0, 0, 0}},
+
+    {u'╞', {0, 1, 3, 1, 0}},
+    {u'╟', {0, 3, 1, 3, 0}},
+    {u'╠', {0, 3, 3, 3, 0}},
+
+    {u'╡', {3, 1, 0, 1, 0}},
+    {u'╢', {1, 3, 0, 3, 0}},
+    {u'╣', {3, 3, 0, 3, 0}},
+
+    {u'╤', {3, 0, 3, 1, 0}},
+    {u'╥', {1, 0, 1, 3, 0}},
+    {u'╦', {3, 0, 3, 3, 0}},
+
+    {u'╧', {3, 1, 3, 0, 0}},
+    {u'╨', {1, 3, 1, 0, 0}},
+    {u'╩', {3, 3, 3, 0, 0}},
+
+    {u'╪', {3, 1, 3, 1, 0}},
+    {u'╫', {1, 3, 1, 3, 0}},
+    {u'╬', {3, 3, 3, 3, 0}},
+
+    {u'╭', {0, 0, 1, 1, 1}},
+    {u'╮', {1, 0, 0, 1, 1}},
+    {u'╯', {1, 1, 0, 0, 1}},
+    {u'╰', {0, 1, 1, 0, 1}},
+
+    {u'╴', {1, 0, 0, 0, 0}},
+    {u'╵', {0, 1, 0, 0, 0}},
+    {u'╶', {0, 0, 1, 0, 0}},
+    {u'╷', {0, 0, 0, 1, 0}},
+
+    {u'╸', {2, 0, 0, 0, 0}},
+    {u'╹', {0, 2, 0, 0, 0}},
+    {u'╺', {0, 0, 2, 0, 0}},
+    {u'╻', {0, 0, 0, 2, 0}},
+
+    {u'╼', {1, 0, 2, 0, 0}},
+    {u'╽', {0, 1, 0, 2, 0}},
+    {u'╾', {2, 0, 1, 0, 0}},
+    {u'╿', {0, 2, 0, 1, 0}},
 };
 // clang-format on
 
-template <class A, class B>
-std::map<B, A> InvertMap(const std::map<A, B>& input) {
-  std::map<B, A> output;
-  for (const auto& it : input) {
-    output[it.second] = it.first;
+struct TileTables {
+  // Box index -> packed TileEncoding, or kNoTile.
+  std::array<std::uint16_t, kBoxCount> encoding{};
+  // Packed TileEncoding -> Box index, or kNoBox.
+  std::array<std::uint8_t, kTileEncodingCount> box{};
+};
+
+constexpr TileTables MakeTileTables() {
+  TileTables tables;
+  for (auto& encoding : tables.encoding) {
+    encoding = kNoTile;
   }
-  return output;
+  for (auto& box : tables.box) {
+    box = kNoBox;
+  }
+  for (const Tile& tile : kTiles) {
+    const auto box = static_cast<std::uint8_t>(tile.codepoint - kBoxFirst);
+    const std::uint16_t packed = Pack(tile.encoding);
+    tables.encoding[box] = packed;
+    // When several characters share the same encoding, use the last one.
+    if (tables.box[packed] == kNoBox || tables.box[packed] < box) {
+      tables.box[packed] = box;
+    }
+  }
+  return tables;
 }
 
-const std::map<TileEncoding, std::string> tile_encoding_inverse =  // NOLINT
-    InvertMap(tile_encoding);
+constexpr TileTables kTileTables = MakeTileTables();
 
-void UpgradeLeftRight(std::string& left, std::string& right) {
-  const auto it_left = tile_encoding.find(left);
-  if (it_left == tile_encoding.end()) {
-    return;
+// Return the TileEncoding of a box drawing character.
+bool GetTileEncoding(const Glyph& glyph, TileEncoding* encoding) {
+  const std::string_view str = glyph.str();
+  if (str.size() != 3 || str[0] != '\xE2' ||
+      (str[1] != '\x94' && str[1] != '\x95')) {
+    return false;
   }
-  const auto it_right = tile_encoding.find(right);
-  if (it_right == tile_encoding.end()) {
-    return;
+  const int box = ((str[1] - '\x94') << 6) | (str[2] & 0x3F);  // NOLINT
+  const std::uint16_t packed = kTileTables.encoding[box];
+  if (packed == kNoTile) {
+    return false;
   }
+  *encoding = Unpack(packed);
+  return true;
+}
 
-  if (it_left->second.right == 0 && it_right->second.left != 0) {
-    TileEncoding encoding_left = it_left->second;
-    encoding_left.right = it_right->second.left;
-    const auto it_left_upgrade = tile_encoding_inverse.find(encoding_left);
-    if (it_left_upgrade != tile_encoding_inverse.end()) {
-      left = it_left_upgrade->second;
+// Replace |glyph| by the box drawing character with the given encoding, if it
+// exists.
+void SetTileEncoding(Glyph& glyph, const TileEncoding& encoding) {
+  static const auto glyphs = [] {
+    std::array<Glyph, kBoxCount> output;
+    for (int box = 0; box < kBoxCount; ++box) {
+      const char utf8[3] = {
+          '\xE2',
+          static_cast<char>(0x94 + (box >> 6)),     // NOLINT
+          static_cast<char>(0x80 | (box & 0x3F)),  // NOLINT
+      };
+      output[box] = std::string_view(utf8, 3);
     }
-  }
+    return output;
+  }();
 
-  if (it_right->second.left == 0 && it_left->second.right != 0) {
-    TileEncoding encoding_right = it_right->second;
-    encoding_right.left = it_left->second.right;
-    const auto it_right_upgrade = tile_encoding_inverse.find(encoding_right);
-    if (it_right_upgrade != tile_encoding_inverse.end()) {
-      right = it_right_upgrade->second;
-    }
+  const std::uint8_t box = kTileTables.box[Pack(encoding)];
+  if (box != kNoBox) {
+    glyph = glyphs[box];
   }
 }
 
-void UpgradeTopDown(std::string& top, std::string& down) {
-  const auto it_top = tile_encoding.find(top);
-  if (it_top == tile_encoding.end()) {
+void UpgradeLeftRight(Glyph& left, Glyph& right) {
+  TileEncoding encoding_left;
+  TileEncoding encoding_right;
+  if (!GetTileEncoding(left, &encoding_left) ||
+      !GetTileEncoding(right, &encoding_right)) {
     return;
   }
-  const auto it_down = tile_encoding.find(down);
-  if (it_down == tile_encoding.end()) {
+
+  if (encoding_left.right == 0 && encoding_right.left != 0) {
+    TileEncoding upgrade = encoding_left;
+    upgrade.right = encoding_right.left;
+    SetTileEncoding(left, upgrade);
+  }
+
+  if (encoding_right.left == 0 && encoding_left.right != 0) {
+    TileEncoding upgrade = encoding_right;
+    upgrade.left = encoding_left.right;
+    SetTileEncoding(right, upgrade);
+  }
+}
+
+void UpgradeTopDown(Glyph& top, Glyph& down) {
+  TileEncoding encoding_top;
+  TileEncoding encoding_down;
+  if (!GetTileEncoding(top, &encoding_top) ||
+      !GetTileEncoding(down, &encoding_down)) {
     return;
   }
 
-  if (it_top->second.down == 0 && it_down->second.top != 0) {
-    TileEncoding encoding_top = it_top->second;
-    encoding_top.down = it_down->second.top;
-    const auto it_top_down = tile_encoding_inverse.find(encoding_top);
-    if (it_top_down != tile_encoding_inverse.end()) {
-      top = it_top_down->second;
-    }
+  if (encoding_top.down == 0 && encoding_down.top != 0) {
+    TileEncoding upgrade = encoding_top;
+    upgrade.down = encoding_down.top;
+    SetTileEncoding(top, upgrade);
   }
 
-  if (it_down->second.top == 0 && it_top->second.down != 0) {
-    TileEncoding encoding_down = it_down->second;
-    encoding_down.top = it_top->second.down;
-    const auto it_down_top = tile_encoding_inverse.find(encoding_down);
-    if (it_down_top != tile_encoding_inverse.end()) {
-      down = it_down_top->second;
-    }
+  if (encoding_down.top == 0 && encoding_top.down != 0) {
+    TileEncoding upgrade = encoding_down;
+    upgrade.top = encoding_top.down;
+    SetTileEncoding(down, upgrade);
   }
 }
 
-bool ShouldAttemptAutoMerge(Cell& cell) {
+bool ShouldAttemptAutoMerge(const Cell& cell) {
   return cell.automerge && cell.character.size() == 3;
 }
 
@@ -431,9 +621,11 @@ Screen::Screen(int dimx, int dimy) : Surface{dimx, dimy} {
 /// @note Don't forget to flush stdout. Alternatively, you can use
 /// Screen::Print();
 std::string Screen::ToString() const {
-  // Pre-allocate: ~30 bytes per cell for character + escape codes.
+  // Pre-allocate one byte per cell, and the line breaks. The string grows
+  // geometrically when styles are used. To bound the memory used by large
+  // screens, use an OutputSink instead.
   std::string ss;
-  ss.reserve(static_cast<size_t>(dimx_) * static_cast<size_t>(dimy_) * 30);
+  ss.reserve(static_cast<size_t>(dimx_ + 2) * static_cast<size_t>(dimy_));
   ToString(ss);
   return ss;
 }
@@ -442,17 +634,72 @@ std::string Screen::ToString() const {
 /// terminal.
 /// @param ss The string to append to.
 void Screen::ToString(std::string& ss) const {
+  // Rows are independent: the style is reset in between them. Large screens
+  // are split into bands of rows, serialized in parallel, and concatenated.
+  constexpr int kMinCellsPerBand = 4096;
+  const int bands = std::min({serialization_threads_, dimy_,
+                              dimx_ * dimy_ / kMinCellsPerBand});
+  if (bands <= 1) {
+    Serialize(ss, 0, dimy_);
+    return;
+  }
+
+  // Reused across calls, to keep their capacity.
+  thread_local std::vector<std::string> band_outputs;
+  std::vector<std::string>& outputs = band_outputs;
+  outputs.resize(static_cast<size_t>(bands));
+  ThreadPool::Get().Run(bands, [&](int band) {
+    std::string& output = outputs[band];
+    output.clear();
+    Serialize(output, dimy_ * band / bands, dimy_ * (band + 1) / bands);
+  });
+
+  size_t size = ss.size() + 2 * static_cast<size_t>(bands);
+  for (const auto& output : outputs) {
+    size += output.size();
+  }
+  ss.reserve(size);
+  for (int band = 0; band < bands; ++band) {
+    if (band != 0) {
+      ss += "\r\n";
+    }
+    ss += outputs[band];
+  }
+}
+
+/// Stream the output printing the Screen on the terminal into |out|. The
+/// memory used doesn't depend on the size of the screen.
+/// @param out The sink to write to.
+void Screen::ToString(OutputSink& out) const {
+  Serialize(out, 0, dimy_);
+}
+
+// Serialize the rows in [y_begin, y_end), starting and ending with the default
+// style.
+template <typename Output>
+void Screen::Serialize(Output& ss, int y_begin, int y_end) const {
   const Cell default_cell;
   const Cell* previous_cell_ref = &default_cell;
 
-  for (int y = 0; y < dimy_; ++y) {
+  for (int y = y_begin; y < y_end; ++y) {
     // New line in between two lines.
-    if (y != 0) {
+    if (y != y_begin) {
       UpdateCellStyle(this, ss, *previous_cell_ref, default_cell);
       previous_cell_ref = &default_cell;
       ss += "\r\n";
     }
 
+    // The undamaged rows are blank.
+    if (IsBlankOutsideDamage() && dimx_ > 0) {
+      const Box damage = RowDamage(y);
+      if (damage.x_min > damage.x_max) {
+        UpdateCellStyle(this, ss, *previous_cell_ref, default_cell);
+        previous_cell_ref = &default_cell;
+        AppendSpaces(ss, dimx_);
+        continue;
+      }
+    }
+
     // After printing a fullwith character, we need to skip the next cell.
     bool previous_fullwidth = false;
     if (dimx_ > 0) {
@@ -469,22 +716,250 @@ void Screen::ToString(std::string& ss) const {
             ss += cell.character;
           }
         }
-        if (cell.character.size() <= 1) {
-          previous_fullwidth = false;
+        previous_fullwidth = cell.character.full_width();
+      }
+    }
+  }
+
+  // Reset the style to default:
+  UpdateCellStyle(this, ss, *previous_cell_ref, default_cell);
+}
+
+/// Produce a std::string updating the terminal currently displaying the
+/// |previous| screen into this one. Only the cells that changed are printed,
+/// the cursor is moved in between them.
+///
+/// Like the other ToString, this starts from the top-left corner of the
+/// screen, and leaves the cursor at the same position a full repaint would
+/// have. Line wrapping is expected to be disabled.
+///
+/// When |scroll| is true, a block of rows moved vertically since |previous|
+/// is moved using the terminal scrolling region (DECSTBM) and SU/SD, instead
+/// of being repainted. This requires the screen to cover the whole terminal,
+/// since the scrolling region is expressed in terminal coordinates.
+///
+/// When the dimensions differ, or when it is cheaper, this falls back to a
+/// full repaint.
+///
+/// @param ss The string to append to.
+/// @param previous The screen currently displayed by the terminal.
+/// @param scroll Whether the terminal scrolling region can be used.
+void Screen::ToString(std::string& ss,
+                      const Screen& previous,
+                      bool scroll) const {
+  if (previous.dimx_ != dimx_ || previous.dimy_ != dimy_ || dimx_ == 0) {
+    ToString(ss);
+    return;
+  }
+
+  const size_t start = ss.size();
+  SerializeDiff(ss, previous, scroll);
+
+  // A full repaint costs at least one byte per visible cell. Above this, check
+  // whether it would be smaller.
+  const size_t size = ss.size() - start;
+  if (size > static_cast<size_t>(dimx_) * static_cast<size_t>(dimy_) / 2) {
+    std::string full;
+    full.reserve(size);
+    ToString(full);
+    if (full.size() < size) {
+      ss.resize(start);
+      ss += full;
+    }
+  }
+}
+
+/// Same as the std::string version, streaming the output into |out|.
+///
+/// The difference is staged until it is known to be smaller than a full
+/// repaint, which requires at most half a byte per cell. Otherwise, the size
+/// of both are measured, and the smaller one is serialized again into |out|.
+///
+/// @param out The sink to write to.
+/// @param previous The screen currently displayed by the terminal.
+/// @param scroll Whether the terminal scrolling region can be used.
+void Screen::ToString(OutputSink& out,
+                      const Screen& previous,
+                      bool scroll) const {
+  if (previous.dimx_ != dimx_ || previous.dimy_ != dimy_ || dimx_ == 0) {
+    ToString(out);
+    return;
+  }
+
+  const size_t threshold =
+      static_cast<size_t>(dimx_) * static_cast<size_t>(dimy_) / 2;
+  std::array<char, 256> buffer;  // NOLINT
+
+  std::string staged;
+  OutputSink staging(buffer.data(), buffer.size(), [&](std::string_view data) {
+    if (staged.size() <= threshold) {
+      staged += data;
+    }
+  });
+  SerializeDiff(staging, previous, scroll);
+  staging.Flush();
+  const size_t size = staging.size();
+  if (size <= threshold) {
+    out += staged;
+    return;
+  }
+
+  OutputSink counter(buffer.data(), buffer.size(), [](std::string_view) {});
+  Serialize(counter, 0, dimy_);
+  counter.Flush();
+  if (counter.size() < size) {
+    Serialize(out, 0, dimy_);
+  } else {
+    SerializeDiff(out, previous, scroll);
+  }
+}
+
+template <typename Output>
+void Screen::SerializeDiff(Output& ss,
+                           const Screen& previous,
+                           bool scroll) const {
+  const Cell default_cell;
+  const Cell* previous_cell_ref = &default_cell;
+  int cursor_x = 0;
+  int cursor_y = 0;
+
+  // The lines currently displayed by the terminal.
+  std::vector<const Cell*> displayed(static_cast<size_t>(dimy_));
+  for (int y = 0; y < dimy_; ++y) {
+    displayed[y] = &previous.FastCellAt(0, y);
+  }
+
+  // Move the rows shifted vertically using the terminal scrolling region.
+  const std::vector<Cell> blank_line(scroll ? dimx_ : 0);
+  if (scroll && dimy_ >= 3) {
+    std::vector<size_t> next_hash(static_cast<size_t>(dimy_));
+    std::vector<size_t> previous_hash(static_cast<size_t>(dimy_));
+    for (int y = 0; y < dimy_; ++y) {
+      next_hash[y] = HashLine(*this, &FastCellAt(0, y), dimx_);
+      previous_hash[y] = HashLine(previous, displayed[y], dimx_);
+    }
+
+    const Scroll s = FindScroll(next_hash, previous_hash);
+
+    // Guard against hash collisions.
+    bool valid = s.gain >= 2;
+    for (int y = s.top; valid && y <= s.bottom; ++y) {
+      const int from = y + s.shift;
+      if (from < s.top || from > s.bottom) {
+        continue;
+      }
+      for (int x = 0; valid && x < dimx_; ++x) {
+        valid = SameCell(*this, FastCellAt(x, y), previous,
+                         previous.FastCellAt(x, from));
+      }
+    }
+
+    if (valid) {
+      // The lines exposed by the scroll are filled with the current
+      // background color. It is the default one at this point.
+      ss += "\x1B[" + std::to_string(s.top + 1) + ";" +
+            std::to_string(s.bottom + 1) + "r";  // SET_SCROLLING_REGION
+      if (s.shift > 0) {
+        ss += "\x1B[" + std::to_string(s.shift) + "S";  // SCROLL_UP
+      } else {
+        ss += "\x1B[" + std::to_string(-s.shift) + "T";  // SCROLL_DOWN
+      }
+      ss += "\x1B[r";  // RESET_SCROLLING_REGION, and move to the top-left.
+
+      for (int y = s.top; y <= s.bottom; ++y) {
+        const int from = y + s.shift;
+        displayed[y] = (from >= s.top && from <= s.bottom)
+                           ? &previous.FastCellAt(0, from)
+                           : blank_line.data();
+      }
+    }
+  }
+
+  // When both screens are blank outside of their damage, a row can only
+  // differ in the union of both damages.
+  const bool damage_only =
+      IsBlankOutsideDamage() && previous.IsBlankOutsideDamage();
+
+  std::vector<bool> dirty(static_cast<size_t>(dimx_));
+  for (int y = 0; y < dimy_; ++y) {
+    const Cell* line = &FastCellAt(0, y);
+    const Cell* previous_line = displayed[y];
+
+    // The cells compared are [x_begin, x_end). The cell after them is blank on
+    // both sides, but might have to be drawn again below.
+    int x_begin = 0;
+    int x_end = dimx_;
+    if (damage_only && previous_line == &previous.FastCellAt(0, y)) {
+      const Box damage = Box::Union(RowDamage(y), previous.RowDamage(y));
+      if (damage.x_min > damage.x_max) {
+        continue;
+      }
+      x_begin = damage.x_min;
+      x_end = damage.x_max + 1;
+    }
+    const int x_stop = std::min(x_end + 1, dimx_);
+
+    bool row_dirty = false;
+    for (int x = x_begin; x < x_end; ++x) {
+      dirty[x] = !SameCell(*this, line[x], previous, previous_line[x]);
+      row_dirty |= dirty[x];
+    }
+    if (!row_dirty) {
+      continue;
+    }
+    if (x_end < dimx_) {
+      dirty[x_end] = false;
+    }
+
+    // Overwriting a fullwidth character erases both of its halves. The
+    // second one must be drawn again.
+    for (int x = x_begin; x + 1 < x_stop; ++x) {
+      if (dirty[x] && previous_line[x].character.full_width()) {
+        dirty[x + 1] = true;
+      }
+    }
+
+    bool previous_fullwidth = false;
+    for (int x = x_begin; x < x_stop; ++x) {
+      const Cell& cell = line[x];
+      if (!previous_fullwidth && dirty[x]) {
+        MoveCursor(ss, cursor_x, cursor_y, x, y);
+        UpdateCellStyle(this, ss, *previous_cell_ref, cell);
+        previous_cell_ref = &cell;
+        if (cell.character.empty()) {
+          ss += ' ';
         } else {
-          previous_fullwidth = (string_width(cell.character) == 2);
+          ss += cell.character;
+        }
+        cursor_x = x + (cell.character.full_width() ? 2 : 1);
+
+        // The terminal may keep the cursor in the last column.
+        if (cursor_x >= dimx_) {
+          cursor_x = -1;
         }
       }
+      previous_fullwidth = cell.character.full_width();
     }
   }
 
   // Reset the style to default:
   UpdateCellStyle(this, ss, *previous_cell_ref, default_cell);
+
+  // Leave the cursor where a full repaint would: at the end of the last line.
+  MoveCursor(ss, cursor_x, cursor_y, 0, dimy_ - 1);
+  ss += "\x1B[" + std::to_string(dimx_) + "C";  // MOVE_RIGHT
 }
 
 // Print the Screen to the terminal.
 void Screen::Print() const {
-  std::cout << ToString() << '\0' << std::flush;
+  std::array<char, 4096> buffer;  // NOLINT
+  OutputSink out(buffer.data(), buffer.size(), [](std::string_view data) {
+    std::cout.write(data.data(), static_cast<std::streamsize>(data.size()));
+  });
+  ToString(out);
+  out += '\0';
+  out.Flush();
+  std::cout << std::flush;
 }
 
 /// @brief Return a string to be printed in order to reset the cursor position
@@ -546,53 +1021,100 @@ void Screen::Clear() {
   cursor_.x = dimx_ - 1;
   cursor_.y = dimy_ - 1;
 
-  hyperlinks_ = {
-      "",
-  };
+  // The hyperlinks are reused from one frame to the next. Start over only
+  // when half of the ids are used, so that a frame can't run out of them.
+  if (hyperlinks_.size() > std::numeric_limits<std::uint16_t>::max() / 2) {
+    hyperlinks_ = {
+        "",
+    };
+    hyperlinks_index_.clear();
+  }
+}
+
+/// @brief Exchange the cells of two screens, and the hyperlinks they refer to.
+/// This doesn't copy nor allocate anything. This can be used for double
+/// buffering.
+/// @param other The screen to swap with.
+void Screen::Swap(Screen& other) {
+  Surface::Swap(other);
+  hyperlinks_.swap(other.hyperlinks_);
+  hyperlinks_index_.swap(other.hyperlinks_index_);
 }
 
 // clang-format off
 void Screen::ApplyShader() {
-  // Merge box characters together.
-  for (int y = 0; y < dimy_; ++y) {
-    for (int x = 0; x < dimx_; ++x) {
+  // Merge box characters together. Only the span of each row containing
+  // automerge cells is visited. When the damage is tracked, the undamaged
+  // cells are blank, and are skipped.
+  const bool damage_only = IsBlankOutsideDamage();
+  int previous_first = 0;
+  int previous_last = -1;
+  for (int y = 0; y < dimy_ && dimx_ > 0; ++y) {
+    Cell* line = &FastCellAt(0, y);
+    int first = 0;
+    int end = dimx_;
+    if (damage_only) {
+      const Box damage = RowDamage(y);
+      first = std::min(damage.x_min, dimx_);
+      end = damage.x_max + 1;
+    }
+    while (first < end && !line[first].automerge) {
+      ++first;
+    }
+    if (first >= end) {
+      previous_first = 0;
+      previous_last = -1;
+      continue;
+    }
+    int last = end - 1;
+    while (!line[last].automerge) {
+      --last;
+    }
+
+    for (int x = first; x <= last; ++x) {
       // Box drawing character uses exactly 3 byte.
-      Cell& cur = FastCellAt(x, y);
+      Cell& cur = line[x];
       if (!ShouldAttemptAutoMerge(cur)) {
         continue;
       }
 
-      if (x > 0) {
-        Cell& left = FastCellAt(x - 1, y);
+      if (x > first) {
+        Cell& left = line[x - 1];
         if (ShouldAttemptAutoMerge(left)) {
           UpgradeLeftRight(left.character, cur.character);
         }
       }
-      if (y > 0) {
+      if (x >= previous_first && x <= previous_last) {
         Cell& top = FastCellAt(x, y - 1);
         if (ShouldAttemptAutoMerge(top)) {
           UpgradeTopDown(top.character, cur.character);
         }
       }
     }
+    previous_first = first;
+    previous_last = last;
   }
 }
 // clang-format on
 
-std::uint8_t Screen::RegisterHyperlink(std::string_view link) {
-  for (std::size_t i = 0; i < hyperlinks_.size(); ++i) {
-    if (hyperlinks_[i] == link) {
-      return i;
+std::uint16_t Screen::RegisterHyperlink(std::string_view link) {
+  const size_t hash = std::hash<std::string_view>()(link);
+  const auto range = hyperlinks_index_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (hyperlinks_[it->second] == link) {
+      return it->second;
     }
   }
-  if (hyperlinks_.size() == std::numeric_limits<std::uint8_t>::max()) {
+  if (hyperlinks_.size() > std::numeric_limits<std::uint16_t>::max()) {
     return 0;
   }
+  const auto id = static_cast<std::uint16_t>(hyperlinks_.size());
   hyperlinks_.emplace_back(link);
-  return hyperlinks_.size() - 1;
+  hyperlinks_index_.emplace(hash, id);
+  return id;
 }
 
-const std::string& Screen::Hyperlink(std::uint8_t id) const {
+const std::string& Screen::Hyperlink(std::uint16_t id) const {
   if (id >= hyperlinks_.size()) {
     return hyperlinks_[0];
   }
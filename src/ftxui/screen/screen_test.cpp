@@ -1,9 +1,17 @@
 // Copyright 2024 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
+#include <algorithm>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
+#include "ftxui/screen/color.hpp"
+#include "ftxui/screen/output_sink.hpp"
 #include "ftxui/screen/screen.hpp"
+#include "ftxui/screen/string.hpp"
 #include "gtest/gtest.h"
 
 namespace ftxui {
@@ -44,6 +52,162 @@ int RowsMovedUp(const std::string& s) {
   }
   return total;
 }
+
+// A minimal terminal emulator, interpreting the output of Screen::ToString.
+// Only the glyphs are tracked. Line wrapping is disabled.
+class FakeTerminal {
+ public:
+  FakeTerminal(int dimx, int dimy)
+      : dimx_(dimx),
+        dimy_(dimy),
+        cells_(static_cast<size_t>(dimx * dimy), " ") {}
+
+  void Write(const std::string& s) {
+    size_t i = 0;
+    while (i < s.size()) {
+      // Control Sequence Introducer.
+      if (s.compare(i, 2, "\x1B[") == 0) {
+        i += 2;
+        std::vector<int> params = {0};
+        bool has_digits = false;
+        while (i < s.size() && ((s[i] >= '0' && s[i] <= '9') || s[i] == ';' ||
+                                s[i] == '?')) {
+          if (s[i] >= '0' && s[i] <= '9') {
+            params.back() = params.back() * 10 + (s[i] - '0');
+            has_digits = true;
+          }
+          if (s[i] == ';') {
+            params.push_back(0);
+          }
+          ++i;
+        }
+        const int n = has_digits ? params[0] : 1;
+        switch (s[i++]) {
+          case 'A':
+            y_ = std::max(0, y_ - n);
+            break;
+          case 'B':
+            y_ = std::min(dimy_ - 1, y_ + n);
+            break;
+          case 'C':
+            x_ = std::min(dimx_ - 1, x_ + n);
+            break;
+          case 'D':
+            x_ = std::max(0, x_ - n);
+            break;
+          case 'G':
+            x_ = std::min(dimx_ - 1, n - 1);
+            break;
+          case 'r':  // Set the scrolling region, and move to the top-left.
+            top_ = has_digits ? params[0] - 1 : 0;
+            bottom_ = params.size() > 1 ? params[1] - 1 : dimy_ - 1;
+            x_ = 0;
+            y_ = 0;
+            break;
+          case 'S':
+            Scroll(n);
+            break;
+          case 'T':
+            Scroll(-n);
+            break;
+          default:
+            break;
+        }
+        continue;
+      }
+
+      // Operating System Command, terminated by ST.
+      if (s.compare(i, 2, "\x1B]") == 0) {
+        i = s.find("\x1B\\", i) + 2;
+        continue;
+      }
+
+      if (s[i] == '\r') {
+        x_ = 0;
+        ++i;
+        continue;
+      }
+
+      if (s[i] == '\n') {
+        y_ = std::min(dimy_ - 1, y_ + 1);
+        ++i;
+        continue;
+      }
+
+      size_t end = i + 1;
+      while (end < s.size() && (s[end] & 0b1100'0000) == 0b1000'0000) {
+        ++end;
+      }
+      Print(s.substr(i, end - i));
+      i = end;
+    }
+  }
+
+  std::string Content() const {
+    std::string out;
+    for (int y = 0; y < dimy_; ++y) {
+      for (int x = 0; x < dimx_; ++x) {
+        out += At(x, y);
+      }
+      out += '\n';
+    }
+    return out;
+  }
+
+ private:
+  std::string& At(int x, int y) { return cells_[y * dimx_ + x]; }
+  const std::string& At(int x, int y) const { return cells_[y * dimx_ + x]; }
+
+  // Scroll the content of the scrolling region up by |n| lines.
+  void Scroll(int n) {
+    std::vector<std::string> region(cells_.begin() + top_ * dimx_,
+                                    cells_.begin() + (bottom_ + 1) * dimx_);
+    for (int y = top_; y <= bottom_; ++y) {
+      for (int x = 0; x < dimx_; ++x) {
+        const int from = y + n;
+        At(x, y) = (from >= top_ && from <= bottom_)
+                       ? region[(from - top_) * dimx_ + x]
+                       : " ";
+      }
+    }
+  }
+
+  void Print(const std::string& glyph) {
+    const int width = string_width(glyph);
+    // Overwriting one half of a fullwidth character erases the other half.
+    if (At(x_, y_).empty() && x_ > 0) {
+      At(x_ - 1, y_) = " ";
+    }
+    if (x_ + 1 < dimx_ && At(x_ + 1, y_).empty()) {
+      At(x_ + 1, y_) = " ";
+    }
+
+    At(x_, y_) = glyph;
+    if (width == 2 && x_ + 1 < dimx_) {
+      if (x_ + 2 < dimx_ && At(x_ + 2, y_).empty()) {
+        At(x_ + 2, y_) = " ";
+      }
+      At(x_ + 1, y_) = "";
+    }
+    x_ = std::min(dimx_ - 1, x_ + width);
+  }
+
+  int dimx_;
+  int dimy_;
+  int x_ = 0;
+  int y_ = 0;
+  int top_ = 0;
+  int bottom_ = dimy_ - 1;
+  std::vector<std::string> cells_;
+};
+
+// Draw |glyph| at (x,y) the same way the dom elements do.
+void Draw(Screen& screen, int x, int y, const std::string& glyph) {
+  screen.at(x, y) = glyph;
+  if (string_width(glyph) == 2) {
+    screen.at(x + 1, y) = "";
+  }
+}
 }  // namespace
 
 // The non-clear ResetPosition emits a single parameterized CSI cursor-up.
@@ -121,4 +285,530 @@ TEST(ScreenTest, NegativeAndZeroDimensions) {
   });
 }
 
+// An identical screen produces no glyph, only cursor moves.
+TEST(ScreenTest, ToStringDiffIdentical) {
+  Screen previous(10, 3);
+  Draw(previous, 0, 0, "a");
+  Screen next = previous;
+
+  const std::string output = [&] {
+    std::string out;
+    next.ToString(out, previous);
+    return out;
+  }();
+  EXPECT_EQ(output, "\x1B[2B\x1B[10C");
+}
+
+// Only the modified cells are printed.
+TEST(ScreenTest, ToStringDiffSingleCell) {
+  Screen previous(80, 24);
+  for (int y = 0; y < 24; ++y) {
+    for (int x = 0; x < 80; ++x) {
+      Draw(previous, x, y, "a");
+    }
+  }
+  Screen next = previous;
+  Draw(next, 40, 10, "b");
+
+  std::string output;
+  next.ToString(output, previous);
+  EXPECT_EQ(output, "\x1B[10B\x1B[40Cb\x1B[13B\r\x1B[80C");
+  EXPECT_LT(output.size(), next.ToString().size() / 50);
+}
+
+// Screens with different dimensions are fully repainted.
+TEST(ScreenTest, ToStringDiffResized) {
+  Screen previous(10, 3);
+  Screen next(12, 3);
+  Draw(next, 0, 0, "a");
+
+  std::string output;
+  next.ToString(output, previous);
+  EXPECT_EQ(output, next.ToString());
+}
+
+// When every cell changes, a full repaint is cheaper.
+TEST(ScreenTest, ToStringDiffFallbackToFullRepaint) {
+  Screen previous(10, 3);
+  Screen next(10, 3);
+  for (int y = 0; y < 3; ++y) {
+    for (int x = 0; x < 10; ++x) {
+      Draw(next, x, y, "b");
+    }
+  }
+
+  std::string output;
+  next.ToString(output, previous);
+  EXPECT_EQ(output, next.ToString());
+}
+
+// Applying the diff onto a terminal displaying the previous screen gives the
+// same content as a full repaint, including with fullwidth characters.
+TEST(ScreenTest, ToStringDiffEmulated) {
+  const std::vector<std::string> glyphs = {"a", "b", " ", "测", "试", "─"};
+  const int dimx = 13;
+  const int dimy = 5;
+
+  uint32_t seed = 42;
+  auto random = [&](int n) {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int>((seed >> 16) % static_cast<uint32_t>(n));
+  };
+
+  auto random_screen = [&](const Screen& base, int changes) {
+    Screen screen = base;
+    for (int i = 0; i < changes; ++i) {
+      const int x = random(dimx - 1);
+      const int y = random(dimy);
+      Draw(screen, x, y, glyphs[random(glyphs.size())]);
+    }
+    // Drawing a glyph over the second half of a fullwidth one is not
+    // supported by the dom. Restore a valid screen.
+    for (int y = 0; y < dimy; ++y) {
+      for (int x = 0; x + 1 < dimx; ++x) {
+        if (string_width(screen.at(x, y)) == 2) {
+          screen.at(x + 1, y) = "";
+          ++x;
+        } else if (screen.at(x + 1, y).empty()) {
+          screen.at(x + 1, y) = " ";
+        }
+      }
+    }
+    return screen;
+  };
+
+  Screen previous = random_screen(Screen(dimx, dimy), 100);
+  for (int iteration = 0; iteration < 200; ++iteration) {
+    Screen next = random_screen(previous, random(10));
+
+    FakeTerminal terminal(dimx, dimy);
+    terminal.Write(previous.ToString());
+    terminal.Write(previous.ResetPosition());
+    std::string diff;
+    next.ToString(diff, previous);
+    terminal.Write(diff);
+
+    FakeTerminal expected(dimx, dimy);
+    expected.Write(next.ToString());
+    ASSERT_EQ(terminal.Content(), expected.Content())
+        << "iteration=" << iteration;
+
+    previous = next;
+  }
+}
+
+// Box drawing characters flagged for automerge are joined with their
+// neighbors. Cells outside the automerge regions are left untouched.
+TEST(ScreenTest, ApplyShaderAutomerge) {
+  const std::vector<std::string> input = {
+      "┌─┬ │",  //
+      "│ ├─┤",  //
+      "└─┘ ━",  //
+      "  │ │",  //
+  };
+  Screen screen(5, 4);
+  for (int y = 0; y < 4; ++y) {
+    const auto glyphs = Utf8ToGlyphs(input[y]);
+    for (int x = 0; x < 5; ++x) {
+      Cell& cell = screen.CellAt(x, y);
+      cell.character = glyphs[x];
+      cell.automerge = y != 3;
+    }
+  }
+  screen.ApplyShader();
+
+  EXPECT_EQ(screen.ToString(),
+            "┌─┬ │\r\n"
+            "│ ├─┤\r\n"
+            "└─┘ ┷\r\n"
+            "  │ │");
+}
+
+// A log-style screen moving up by one line only prints the new line.
+TEST(ScreenTest, ToStringDiffScroll) {
+  const int dimx = 20;
+  const int dimy = 10;
+  auto log = [&](int first) {
+    Screen screen(dimx, dimy);
+    for (int y = 0; y < dimy; ++y) {
+      const std::string line = "line " + std::to_string(first + y);
+      for (size_t x = 0; x < line.size(); ++x) {
+        screen.at(static_cast<int>(x), y) = std::string(1, line[x]);
+      }
+    }
+    return screen;
+  };
+  const Screen previous = log(0);
+  const Screen next = log(1);
+
+  std::string diff;
+  next.ToString(diff, previous, /*scroll=*/true);
+  EXPECT_EQ(diff,
+            "\x1B[1;10r"  // Set the scrolling region.
+            "\x1B[1S"     // Scroll up.
+            "\x1B[r"      // Reset the scrolling region.
+            "\x1B[9B"     // Move to the last line.
+            "line 10"
+            "\r\x1B[20C");
+
+  // Without the terminal scrolling region, every line is modified.
+  std::string repaint;
+  next.ToString(repaint, previous);
+  EXPECT_GT(repaint.size(), 2 * diff.size());
+
+  FakeTerminal terminal(dimx, dimy);
+  terminal.Write(previous.ToString());
+  terminal.Write(previous.ResetPosition());
+  terminal.Write(diff);
+  FakeTerminal expected(dimx, dimy);
+  expected.Write(next.ToString());
+  EXPECT_EQ(terminal.Content(), expected.Content());
+}
+
+// Random blocks of lines moving up or down, checked against an emulated
+// terminal.
+TEST(ScreenTest, ToStringDiffScrollEmulated) {
+  const std::vector<std::string> glyphs = {"a", "b", "c", " ", "测"};
+  const int dimx = 6;
+  const int dimy = 8;
+
+  uint32_t seed = 7;
+  auto random = [&](int n) {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int>((seed >> 16) % static_cast<uint32_t>(n));
+  };
+
+  auto random_line = [&](Screen& screen, int y) {
+    for (int x = 0; x < dimx; ++x) {
+      const std::string& glyph = glyphs[random(glyphs.size())];
+      if (string_width(glyph) == 2 && x + 1 < dimx) {
+        Draw(screen, x, y, glyph);
+        ++x;
+      } else {
+        Draw(screen, x, y, string_width(glyph) == 2 ? "a" : glyph);
+      }
+    }
+  };
+
+  Screen previous(dimx, dimy);
+  for (int y = 0; y < dimy; ++y) {
+    random_line(previous, y);
+  }
+
+  for (int iteration = 0; iteration < 300; ++iteration) {
+    // Move a block of lines, and fill the exposed ones.
+    Screen next = previous;
+    const int top = random(dimy - 2);
+    const int bottom = top + 2 + random(dimy - top - 2);
+    const int shift = 1 + random(bottom - top);
+    const bool up = random(2) == 0;
+    for (int y = top; y <= bottom; ++y) {
+      const int from = up ? y + shift : y - shift;
+      if (from >= top && from <= bottom) {
+        for (int x = 0; x < dimx; ++x) {
+          next.CellAt(x, y) = previous.CellAt(x, from);
+        }
+      } else {
+        random_line(next, y);
+      }
+    }
+    // And some random changes.
+    for (int i = random(3); i > 0; --i) {
+      random_line(next, random(dimy));
+    }
+
+    FakeTerminal terminal(dimx, dimy);
+    terminal.Write(previous.ToString());
+    terminal.Write(previous.ResetPosition());
+    std::string diff;
+    next.ToString(diff, previous, /*scroll=*/true);
+    terminal.Write(diff);
+
+    FakeTerminal expected(dimx, dimy);
+    expected.Write(next.ToString());
+    ASSERT_EQ(terminal.Content(), expected.Content())
+        << "iteration=" << iteration;
+
+    previous = next;
+  }
+}
+
+// Beyond 65535 hyperlinks, the cells get none. The ids start over on the next
+// Clear().
+TEST(ScreenTest, HyperlinkOverflow) {
+  Screen screen(2, 1);
+  for (int i = 1; i <= 65535; ++i) {
+    ASSERT_EQ(screen.RegisterHyperlink("https://" + std::to_string(i)), i);
+  }
+  EXPECT_EQ(screen.RegisterHyperlink("https://overflow"), 0);
+  EXPECT_EQ(screen.Hyperlink(0), "");
+  // The links registered are still found.
+  EXPECT_EQ(screen.RegisterHyperlink("https://42"), 42);
+  EXPECT_EQ(screen.Hyperlink(65535), "https://65535");
+
+  screen.Clear();
+  EXPECT_EQ(screen.RegisterHyperlink("https://overflow"), 1);
+  EXPECT_EQ(screen.Hyperlink(1), "https://overflow");
+}
+
+TEST(ScreenTest, Swap) {
+  Screen a(2, 1);
+  Screen b(3, 2);
+  a.at(0, 0) = "a";
+  a.CellAt(1, 0).hyperlink = a.RegisterHyperlink("https://a.com");
+  b.at(0, 0) = "b";
+
+  a.Swap(b);
+  EXPECT_EQ(a.dimx(), 3);
+  EXPECT_EQ(a.dimy(), 2);
+  EXPECT_EQ(a.at(0, 0), "b");
+  EXPECT_EQ(b.dimx(), 2);
+  EXPECT_EQ(b.dimy(), 1);
+  EXPECT_EQ(b.at(0, 0), "a");
+  EXPECT_EQ(b.Hyperlink(b.CellAt(1, 0).hyperlink), "https://a.com");
+}
+
+// The stencil follows the cells. Writing anywhere inside the new dimensions
+// works, and writing outside of them is ignored.
+TEST(ScreenTest, SwapStencil) {
+  Screen small(2, 1);
+  Screen large(4, 3);
+  small.Swap(large);
+  EXPECT_EQ(small.stencil, (Box{0, 3, 0, 2}));
+  EXPECT_EQ(large.stencil, (Box{0, 1, 0, 0}));
+
+  small.CellAt(3, 2).character = "x";
+  EXPECT_EQ(small.at(3, 2), "x");
+  large.CellAt(1, 0).character = "y";
+  large.CellAt(3, 2).character = "z";
+  EXPECT_EQ(large.ToString(), " y");
+}
+
+// The data is flushed in chunks no larger than the buffer, except for the
+// data larger than the buffer, passed through directly.
+TEST(ScreenTest, OutputSink) {
+  char buffer[4];
+  std::vector<std::string> chunks;
+  {
+    OutputSink out(buffer, sizeof(buffer), [&](std::string_view data) {
+      chunks.emplace_back(data);
+    });
+    out += "ab";
+    out += 'c';
+    out += "de";
+    out += "";
+    out += "fghij";
+    out += 'k';
+    EXPECT_EQ(out.size(), 11u);
+  }
+  const std::vector<std::string> expected = {"abc", "de", "fghij", "k"};
+  EXPECT_EQ(chunks, expected);
+
+  // Without a buffer, every write is passed through.
+  chunks.clear();
+  OutputSink out(nullptr, 0, [&](std::string_view data) {
+    chunks.emplace_back(data);
+  });
+  out += "ab";
+  out += 'c';
+  EXPECT_EQ(chunks, std::vector<std::string>({"ab", "c"}));
+}
+
+// Streaming a screen into an OutputSink produces the same output as the
+// std::string versions, whatever the size of the buffer.
+TEST(ScreenTest, ToStringOutputSink) {
+  const std::vector<std::string> glyphs = {"a", "b", " ", "测", "─"};
+  const std::vector<Color> colors = {Color::Default, Color::Red,
+                                     Color::RGB(1, 2, 3), Color::Grey50};
+  const int dimx = 13;
+  const int dimy = 5;
+
+  uint32_t seed = 7;
+  auto random = [&](int n) {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int>((seed >> 16) % static_cast<uint32_t>(n));
+  };
+
+  Screen previous(dimx, dimy);
+  for (int iteration = 0; iteration < 50; ++iteration) {
+    Screen next = previous;
+    // From a few cells, to every cell modified.
+    const int changes = random(2) ? random(8) : random(dimx * dimy * 2);
+    for (int i = 0; i < changes; ++i) {
+      const int x = random(dimx - 1);
+      const int y = random(dimy);
+      Draw(next, x, y, glyphs[random(glyphs.size())]);
+      next.CellAt(x, y).foreground_color = colors[random(colors.size())];
+      next.CellAt(x, y).bold = random(2);
+    }
+    if (iteration == 10) {
+      next.CellAt(1, 1).hyperlink = next.RegisterHyperlink("https://a.com");
+    }
+
+    std::string expected_diff;
+    next.ToString(expected_diff, previous);
+
+    for (size_t capacity : {0, 1, 5, 64, 4096}) {
+      std::vector<char> buffer(capacity);
+      std::string full;
+      std::string diff;
+      {
+        OutputSink out(buffer.data(), capacity,
+                       [&](std::string_view data) { full += data; });
+        next.ToString(out);
+        EXPECT_EQ(out.size(), next.ToString().size());
+      }
+      {
+        OutputSink out(buffer.data(), capacity,
+                       [&](std::string_view data) { diff += data; });
+        next.ToString(out, previous);
+      }
+      ASSERT_EQ(full, next.ToString()) << "iteration=" << iteration;
+      ASSERT_EQ(diff, expected_diff) << "iteration=" << iteration;
+    }
+
+    previous = next;
+  }
+}
+
+// Serializing in parallel gives the same output as serially.
+TEST(ScreenTest, ToStringParallel) {
+  const std::vector<std::string> glyphs = {"a", "b", " ", "测", "─"};
+  const std::vector<Color> colors = {Color::Default, Color::Red,
+                                     Color::RGB(1, 2, 3), Color::Grey50};
+  uint32_t seed = 3;
+  auto random = [&](int n) {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int>((seed >> 16) % static_cast<uint32_t>(n));
+  };
+
+  for (const auto& [dimx, dimy] :
+       std::vector<std::pair<int, int>>{{0, 0}, {1, 5000}, {600, 200}}) {
+    Screen screen(dimx, dimy);
+    const uint16_t link = screen.RegisterHyperlink("https://a.com");
+    for (int i = 0; i < dimx * dimy / 3; ++i) {
+      const int x = random(std::max(1, dimx - 1));
+      const int y = random(dimy);
+      Draw(screen, x, y, glyphs[random(glyphs.size())]);
+      screen.CellAt(x, y).background_color = colors[random(colors.size())];
+      screen.CellAt(x, y).italic = random(2);
+      screen.CellAt(x, y).hyperlink = random(8) ? 0 : link;
+    }
+
+    const std::string expected = screen.ToString();
+    for (int threads : {2, 3, 8, 100}) {
+      screen.SetSerializationThreads(threads);
+      std::string output = "prefix";
+      screen.ToString(output);
+      ASSERT_EQ(output, "prefix" + expected)
+          << "dimx=" << dimx << " dimy=" << dimy << " threads=" << threads;
+    }
+  }
+}
+
+// The cells written are recorded as the damage, until the next Clear().
+TEST(ScreenTest, Damage) {
+  Screen screen(6, 4);
+  EXPECT_FALSE(screen.IsTrackingDamage());
+  EXPECT_EQ(screen.Damage(), (Box{0, 5, 0, 3}));
+
+  screen.TrackDamage();
+  EXPECT_TRUE(screen.IsTrackingDamage());
+  EXPECT_GT(screen.Damage().x_min, screen.Damage().x_max);
+
+  screen.at(2, 1) = "a";
+  screen.CellAt(4, 3).bold = true;
+  screen.CellAt(9, 0).bold = true;  // Outside of the screen.
+  EXPECT_EQ(screen.Damage(), (Box{2, 4, 1, 3}));
+  EXPECT_EQ(screen.RowDamage(1), (Box{2, 2, 1, 1}));
+  EXPECT_EQ(screen.RowDamage(3), (Box{4, 4, 3, 3}));
+  EXPECT_GT(screen.RowDamage(0).x_min, screen.RowDamage(0).x_max);
+
+  // Reading doesn't damage the cells.
+  const Screen& const_screen = screen;
+  EXPECT_EQ(const_screen.at(0, 0), "");
+  EXPECT_EQ(screen.Damage(), (Box{2, 4, 1, 3}));
+
+  screen.Clear();
+  EXPECT_GT(screen.Damage().x_min, screen.Damage().x_max);
+  EXPECT_EQ(const_screen.at(2, 1), "");
+  EXPECT_FALSE(const_screen.CellAt(4, 3).bold);
+}
+
+// Clearing only visits the damaged cells. The cells written before the damage
+// was reset are still cleared.
+TEST(ScreenTest, DamageClear) {
+  Screen screen(4, 2);
+  screen.at(0, 0) = "a";
+  screen.TrackDamage();
+  screen.at(1, 1) = "b";
+  screen.ResetDamage();
+  screen.at(3, 0) = "c";
+  EXPECT_EQ(screen.Damage(), (Box{3, 3, 0, 0}));
+  screen.Clear();
+  EXPECT_EQ(screen.ToString(), "    \r\n    ");
+
+  screen.at(2, 1) = "d";
+  screen.Clear();
+  EXPECT_EQ(screen.ToString(), "    \r\n    ");
+}
+
+// Tracking the damage doesn't change the output. Frames are drawn the way App
+// does, double buffering two screens.
+TEST(ScreenTest, DamageEmulated) {
+  const std::vector<std::string> glyphs = {"a", "b", "测", "─", "│", "┼"};
+  uint32_t seed = 7;
+  auto random = [&](int n) {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int>((seed >> 16) % static_cast<uint32_t>(n));
+  };
+
+  const int dimx = 20;
+  const int dimy = 10;
+  Screen tracked(dimx, dimy);
+  Screen tracked_previous(dimx, dimy);
+  Screen untracked(dimx, dimy);
+  Screen untracked_previous(dimx, dimy);
+  tracked.TrackDamage();
+  tracked_previous.TrackDamage();
+
+  for (int frame = 0; frame < 200; ++frame) {
+    // A few rectangles, sometimes covering the whole screen.
+    const int rectangles = random(4);
+    for (int i = 0; i < rectangles; ++i) {
+      const int x_min = random(dimx);
+      const int y_min = random(dimy);
+      const int x_max = std::min(dimx - 2, x_min + random(frame % 7 ? 6 : 30));
+      const int y_max = std::min(dimy - 1, y_min + random(frame % 7 ? 3 : 30));
+      const std::string& glyph = glyphs[random(glyphs.size())];
+      const bool automerge = random(2);
+      const Color color = random(2) ? Color(Color::Red) : Color(Color::Default);
+      for (int y = y_min; y <= y_max; ++y) {
+        for (int x = x_min; x <= x_max; ++x) {
+          for (Screen* screen : {&tracked, &untracked}) {
+            Draw(*screen, x, y, glyph);
+            screen->CellAt(x, y).automerge = automerge;
+            screen->CellAt(x, y).foreground_color = color;
+          }
+        }
+      }
+    }
+    tracked.ApplyShader();
+    untracked.ApplyShader();
+
+    const bool scroll = random(2);
+    std::string expected;
+    std::string output;
+    untracked.ToString(expected, untracked_previous, scroll);
+    tracked.ToString(output, tracked_previous, scroll);
+    ASSERT_EQ(output, expected) << "frame=" << frame;
+    ASSERT_EQ(tracked.ToString(), untracked.ToString()) << "frame=" << frame;
+
+    tracked.Swap(tracked_previous);
+    tracked.Clear();
+    untracked.Swap(untracked_previous);
+    untracked.Clear();
+  }
+}
+
 }  // namespace ftxui
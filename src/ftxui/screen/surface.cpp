@@ -2,8 +2,10 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <algorithm>
+#include <limits>   // for numeric_limits
 #include <sstream>  // IWYU pragma: keep
 #include <string>
+#include <utility>  // for swap
 #include <vector>
 
 #include "ftxui/screen/cell.hpp"
@@ -16,6 +18,10 @@ Cell& dev_null_cell() {
   static Cell cell;
   return cell;
 }
+
+// The damage of a row without damaged cells.
+constexpr std::pair<int, int> kNoDamage = {std::numeric_limits<int>::max(),
+                                           -1};
 }  // namespace
 
 Surface::Surface(int dimx, int dimy)
@@ -27,14 +33,14 @@ Surface::Surface(int dimx, int dimy)
 /// @brief Access a character in a cell at a given position.
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
-std::string& Surface::at(int x, int y) {
+Glyph& Surface::at(int x, int y) {
   return CellAt(x, y).character;
 }
 
 /// @brief Access a character in a cell at a given position.
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
-const std::string& Surface::at(int x, int y) const {
+const Glyph& Surface::at(int x, int y) const {
   return CellAt(x, y).character;
 }
 
@@ -42,7 +48,15 @@ const std::string& Surface::at(int x, int y) const {
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
 Cell& Surface::CellAt(int x, int y) {
-  return stencil.Contain(x, y) ? FastCellAt(x, y) : dev_null_cell();
+  if (!stencil.Contain(x, y)) {
+    return dev_null_cell();
+  }
+  if (track_damage_) {
+    auto& damage = damage_[static_cast<size_t>(y)];
+    damage.first = std::min(damage.first, x);
+    damage.second = std::max(damage.second, x);
+  }
+  return FastCellAt(x, y);
 }
 
 /// @brief Access a cell (Cell) at a given position.
@@ -69,8 +83,105 @@ const Cell& Surface::FastCellAt(int x, int y) const {
 }
 
 /// @brief Clear all the cells from the surface.
+/// When the damage is tracked, only the damaged cells are cleared.
 void Surface::Clear() {
-  std::fill(cells_.begin(), cells_.end(), Cell());
+  if (!IsBlankOutsideDamage()) {
+    std::fill(cells_.begin(), cells_.end(), Cell());
+  } else {
+    for (int y = 0; y < dimy_; ++y) {
+      const auto& damage = damage_[static_cast<size_t>(y)];
+      if (damage.first <= damage.second) {
+        Cell* line = &FastCellAt(0, y);
+        std::fill(line + damage.first, line + damage.second + 1, Cell());
+      }
+    }
+  }
+  ResetDamage();
+  blank_outside_damage_ = true;
+}
+
+/// @brief Exchange the cells and the dimensions of two surfaces. This doesn't
+/// copy nor allocate anything. This can be used for double buffering.
+/// The stencil, the damage, and whether it is tracked, are exchanged too.
+/// @param other The surface to swap with.
+void Surface::Swap(Surface& other) {
+  std::swap(dimx_, other.dimx_);
+  std::swap(dimy_, other.dimy_);
+  std::swap(stencil, other.stencil);
+  cells_.swap(other.cells_);
+  damage_.swap(other.damage_);
+  std::swap(track_damage_, other.track_damage_);
+  std::swap(blank_outside_damage_, other.blank_outside_damage_);
+}
+
+/// @brief Change the dimensions of the surface. The cells are cleared. Their
+/// capacity is kept, so that resizing back and forth doesn't allocate.
+/// @param dimx The new width.
+/// @param dimy The new height.
+void Surface::Resize(int dimx, int dimy) {
+  Clear();
+  dimx_ = std::max(0, dimx);
+  dimy_ = std::max(0, dimy);
+  stencil = {0, dimx_ - 1, 0, dimy_ - 1};
+  cells_.resize(static_cast<size_t>(dimx_) * static_cast<size_t>(dimy_));
+  if (track_damage_) {
+    damage_.resize(static_cast<size_t>(dimy_), kNoDamage);
+  }
+}
+
+/// @brief Enable or disable the damage tracking. When enabled, the cells
+/// accessed for writing using at() and CellAt() are recorded. This allows
+/// Clear(), Screen::ApplyShader() and Screen::ToString() to visit only them.
+///
+/// The cells already written before enabling it are not recorded. The
+/// consumers visit every cell, until the next Clear().
+/// @param enable Whether to track the damage.
+void Surface::TrackDamage(bool enable) {
+  if (enable == track_damage_) {
+    return;
+  }
+  track_damage_ = enable;
+  blank_outside_damage_ = false;
+  damage_.clear();
+  if (enable) {
+    damage_.resize(static_cast<size_t>(dimy_), kNoDamage);
+  }
+}
+
+/// @brief The smallest box containing the damaged cells. Empty if none.
+/// Without damage tracking, this is the whole surface.
+Box Surface::Damage() const {
+  if (!track_damage_) {
+    return {0, dimx_ - 1, 0, dimy_ - 1};
+  }
+  Box box = {std::numeric_limits<int>::max(), -1,
+             std::numeric_limits<int>::max(), -1};
+  for (int y = 0; y < dimy_; ++y) {
+    const auto& damage = damage_[static_cast<size_t>(y)];
+    if (damage.first <= damage.second) {
+      box = Box::Union(box, {damage.first, damage.second, y, y});
+    }
+  }
+  return box;
+}
+
+/// @brief The damaged cells of a row, as a box of height 1. Empty if none.
+/// Without damage tracking, this is the whole row.
+/// @param y The row.
+Box Surface::RowDamage(int y) const {
+  if (!track_damage_) {
+    return {0, dimx_ - 1, y, y};
+  }
+  const auto& damage = damage_[static_cast<size_t>(y)];
+  return {damage.first, damage.second, y, y};
+}
+
+/// @brief Forget the damage recorded so far. Since the cells outside of the
+/// damage are no longer known to be blank, the consumers visit every cell
+/// until the next Clear().
+void Surface::ResetDamage() {
+  std::fill(damage_.begin(), damage_.end(), kNoDamage);
+  blank_outside_damage_ = false;
 }
 
 void Surface::Reserved1() {}
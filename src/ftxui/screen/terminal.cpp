@@ -31,6 +31,7 @@ namespace ftxui {
 namespace {
 
 std::unique_ptr<Terminal::Quirks> g_quirks;
+Terminal::QuirksSnapshot g_quirks_snapshot;  // NOLINT
 bool g_color_support_detected = false;
 
 bool& ColorSupportDetected() {
@@ -49,6 +50,16 @@ Terminal::Quirks& GetQuirksInternal() {
   return *g_quirks;
 }
 
+// Must be called after every modification of the quirks.
+void UpdateQuirksSnapshot() {
+  const Terminal::Quirks& quirks = GetQuirksInternal();
+  g_quirks_snapshot.block_characters = quirks.BlockCharacters();
+  g_quirks_snapshot.cursor_hiding = quirks.CursorHiding();
+  g_quirks_snapshot.component_ascii = quirks.ComponentAscii();
+  g_quirks_snapshot.synchronized_output = quirks.SynchronizedOutput();
+  g_quirks_snapshot.color_support = quirks.ColorSupport();
+}
+
 Dimensions& FallbackSize() {
 #if defined(__EMSCRIPTEN__)
   // This dimension was chosen arbitrarily to be able to display:
@@ -106,6 +117,14 @@ Terminal::Color ComputeColorSupportInternal() {
       "unknown", "unknown", empty_capabilities);
 }
 
+void DetectColorSupport() {
+  if (!ColorSupportDetected()) {
+    GetQuirksInternal().SetColorSupport(ComputeColorSupportInternal());
+    ColorSupportDetected() = true;
+    UpdateQuirksSnapshot();
+  }
+}
+
 }  // namespace
 
 namespace Terminal {
@@ -114,6 +133,7 @@ struct Quirks::Impl {
   bool block_characters = true;
   bool cursor_hiding = true;
   bool component_ascii = false;
+  bool synchronized_output = false;
   Color color_support = Palette256;
 };
 
@@ -151,6 +171,13 @@ void Quirks::SetComponentAscii(bool v) {
   impl_->component_ascii = v;
 }
 
+bool Quirks::SynchronizedOutput() const {
+  return impl_->synchronized_output;
+}
+void Quirks::SetSynchronizedOutput(bool v) {
+  impl_->synchronized_output = v;
+}
+
 Color Quirks::ColorSupport() const {
   return impl_->color_support;
 }
@@ -346,11 +373,7 @@ void SetFallbackSize(const Dimensions& fallbackSize) {
 /// @brief Get the color support of the terminal.
 /// @ingroup screen
 Color ColorSupport() {
-  if (!ColorSupportDetected()) {
-    GetQuirksInternal().SetColorSupport(ComputeColorSupportInternal());
-    ColorSupportDetected() = true;
-  }
-  return GetQuirksInternal().ColorSupport();
+  return GetQuirksSnapshot().color_support;
 }
 
 /// @brief Override terminal color support in case auto-detection fails
@@ -358,15 +381,13 @@ Color ColorSupport() {
 void SetColorSupport(Color color) {
   GetQuirksInternal().SetColorSupport(color);
   ColorSupportDetected() = true;
+  UpdateQuirksSnapshot();
 }
 
 /// @brief Get the terminal quirks.
 /// @ingroup screen
 Quirks GetQuirks() {
-  if (!ColorSupportDetected()) {
-    GetQuirksInternal().SetColorSupport(ComputeColorSupportInternal());
-    ColorSupportDetected() = true;
-  }
+  DetectColorSupport();
   return GetQuirksInternal();
 }
 
@@ -375,6 +396,14 @@ Quirks GetQuirks() {
 void SetQuirks(const Quirks& quirks) {
   GetQuirksInternal() = quirks;
   ColorSupportDetected() = true;
+  UpdateQuirksSnapshot();
+}
+
+/// @brief Get the terminal quirks, without copying them.
+/// @ingroup screen
+const QuirksSnapshot& GetQuirksSnapshot() {
+  DetectColorSupport();
+  return g_quirks_snapshot;
 }
 
 }  // namespace Terminal
@@ -0,0 +1,109 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/thread_pool.hpp"
+
+#include <algorithm>           // for min
+#include <condition_variable>  // for condition_variable
+#include <functional>          // for function
+#include <mutex>               // for unique_lock, lock_guard
+#include <thread>              // for thread, hardware_concurrency
+
+namespace ftxui {
+
+namespace {
+// More threads don't help for serializing a screen.
+constexpr unsigned int kMaxThreads = 8;
+}  // namespace
+
+// static
+ThreadPool& ThreadPool::Get() {
+  static ThreadPool pool;
+  return pool;
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void ThreadPool::Start() {
+  started_ = true;
+#if !defined(__EMSCRIPTEN__)
+  // The calling thread takes part in the work.
+  const unsigned int count =
+      std::min(std::thread::hardware_concurrency(), kMaxThreads);
+  for (unsigned int i = 1; i < count; ++i) {
+    threads_.emplace_back([this] { Work(); });
+  }
+#endif
+}
+
+void ThreadPool::Run(int count, const std::function<void(int)>& task) {
+  const std::lock_guard<std::mutex> run_lock(run_mutex_);
+  if (!started_) {
+    Start();
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    count_ = count;
+    next_ = 0;
+    pending_ = count;
+    generation_++;
+  }
+  wake_.notify_all();
+
+  RunTasks();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this] { return pending_ == 0; });
+  task_ = nullptr;
+}
+
+void ThreadPool::Work() {
+  int generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [&] { return quit_ || generation_ != generation; });
+      if (quit_) {
+        return;
+      }
+      generation = generation_;
+    }
+    RunTasks();
+  }
+}
+
+// Take the next iterations of the current loop, until there are none left.
+void ThreadPool::RunTasks() {
+  while (true) {
+    const std::function<void(int)>* task = nullptr;
+    int index = 0;
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (task_ == nullptr || next_ >= count_) {
+        return;
+      }
+      task = task_;
+      index = next_++;
+    }
+
+    (*task)(index);
+
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (--pending_ == 0) {
+      done_.notify_one();
+    }
+  }
+}
+
+}  // namespace ftxui
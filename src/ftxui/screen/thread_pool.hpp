@@ -0,0 +1,53 @@
+// Copyright 2026 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_THREAD_POOL_HPP
+#define FTXUI_SCREEN_THREAD_POOL_HPP
+
+#include <condition_variable>  // for condition_variable
+#include <functional>          // for function
+#include <mutex>               // for mutex
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+namespace ftxui {
+
+// A small pool of threads, running the iterations of a loop in parallel.
+// The threads are started on first use, and joined on exit.
+class ThreadPool {
+ public:
+  // The pool shared by the whole process.
+  static ThreadPool& Get();
+
+  ~ThreadPool();
+
+  // Run |task(i)| for every i in [0, count), and return once they are all
+  // done. The calling thread takes part. Concurrent calls are serialized.
+  void Run(int count, const std::function<void(int)>& task);
+
+ private:
+  ThreadPool() = default;
+  void Start();
+  void Work();
+  void RunTasks();
+
+  std::vector<std::thread> threads_;
+  bool started_ = false;
+
+  std::mutex run_mutex_;  // Serialize the calls to Run.
+
+  // Protected by |mutex_|:
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  const std::function<void(int)>* task_ = nullptr;
+  int count_ = 0;
+  int next_ = 0;
+  int pending_ = 0;
+  int generation_ = 0;
+  bool quit_ = false;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_THREAD_POOL_HPP